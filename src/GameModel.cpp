@@ -46,15 +46,18 @@ THE SOFTWARE.
 #include "services/ContentKey.hpp"
 #include "services/KeyboardInput.hpp"
 #include "services/SoundPlayer.hpp"
-#include "systems/effects/CircleExpansionEffect.hpp"
-#include "systems/effects/PlayerStartEffect.hpp"
+#include "services/TextureAtlas.hpp"
+#include "systems/effects/EmitterEffect.hpp"
 
 #include <chrono>
 #include <cmath>
+#include <iostream>
+#include <vector>
 
 // Static member implementation
 levels::LevelName GameModel::m_levelSelect{ levels::LevelName::Training1 };
 std::atomic_bool GameModel::m_contentError{ false };
+Content::Handle GameModel::m_contentCommon;
 
 //
 // Prototypes for a few free functions used to manipulate an entity (the player)
@@ -69,37 +72,36 @@ void GameModel::selectLevel(levels::LevelName whichLevel)
     m_levelSelect = whichLevel;
 }
 
+// --------------------------------------------------------------
+//
+// Gets the content for a level the player might choose loading in the
+// background, so that starting it doesn't have to wait on it.
+//
+// --------------------------------------------------------------
+void GameModel::prefetchLevel(levels::LevelName whichLevel)
+{
+    levels::Level::prefetchContent(whichLevel);
+}
+
 GameModel::GameModel()
 {
     switch (m_levelSelect)
     {
         case levels::LevelName::Training1:
-            m_level = std::make_unique<levels::PetriDish>(config::TRAINING_1, true);
-            break;
         case levels::LevelName::Training2:
-            m_level = std::make_unique<levels::PetriDish>(config::TRAINING_2, true);
-            break;
         case levels::LevelName::Training3:
-            m_level = std::make_unique<levels::PetriDish>(config::TRAINING_3, true);
-            break;
         case levels::LevelName::Training4:
-            m_level = std::make_unique<levels::PetriDish>(config::TRAINING_4, true);
-            break;
         case levels::LevelName::Training5:
-            m_level = std::make_unique<levels::PetriDish>(config::TRAINING_5, true);
+            m_level = std::make_unique<levels::PetriDish>(m_levelSelect, true);
             break;
         case levels::LevelName::Patient1:
-            m_level = std::make_unique<levels::PetriDish>(config::PATIENT_1, false);
-            break;
         case levels::LevelName::Patient2:
-            m_level = std::make_unique<levels::PetriDish>(config::PATIENT_2, false);
-            break;
         case levels::LevelName::Patient3:
-            m_level = std::make_unique<levels::PetriDish>(config::PATIENT_3, false);
+            m_level = std::make_unique<levels::PetriDish>(m_levelSelect, false);
             break;
     }
 
-    m_level->loadContent();
+    m_content = Content::whenAll({ m_contentCommon, m_level->loadContent() });
 }
 
 // --------------------------------------------------------------
@@ -107,11 +109,16 @@ GameModel::GameModel()
 // This is where all game model initialization occurs.
 //
 // --------------------------------------------------------------
-void GameModel::initialize()
+bool GameModel::initialize()
 {
-    // Busy wait for the content to finish loading.  It's okay, it happens super fast on first time level is started
-    while (!this->contentReady())
-        ;
+    //
+    // Only blocks if the content isn't ready yet, the Gameplay view waits
+    // for contentReady before initializing, so normally it already is.
+    if (!m_content.get())
+    {
+        std::cout << "unable to load the content for the level" << std::endl;
+        return false;
+    }
 
     m_rendererBackground = std::make_unique<renderers::Background>(
         Content::get<sf::Texture>(m_level->getBackgroundImageKey()),
@@ -120,21 +127,41 @@ void GameModel::initialize()
     m_rendererHUD = std::make_unique<renderers::HUD>();
     m_rendererStatus = std::make_unique<renderers::GameStatus>();
 
+    //
+    // Pack the gameplay images into one texture so sprites and particles can
+    // be drawn in as few batches as possible.  Only rebuilt if any of the
+    // content was reloaded since the last level.
+    TextureAtlas::instance().build({ content::KEY_IMAGE_SARSCOV2,
+                                     content::KEY_IMAGE_SARSCOV2_PARTICLE,
+                                     content::KEY_IMAGE_PLAYER,
+                                     content::KEY_IMAGE_PLAYER_START_PARTICLE,
+                                     content::KEY_IMAGE_PLAYER_PARTICLE,
+                                     content::KEY_IMAGE_BASIC_GUN_BULLET,
+                                     content::KEY_IMAGE_BOMB,
+                                     content::KEY_IMAGE_POWERUP_RAPID_FIRE,
+                                     content::KEY_IMAGE_POWERUP_SPREAD_FIRE,
+                                     content::KEY_IMAGE_POWERUP_BOMB });
+
     m_virusCount = 0;
 
+    //
+    // Any events left from a previous level refer to the systems being replaced below
+    m_timers.clear();
+
     m_sysMovement = std::make_unique<systems::Movement>(*m_level);
     m_sysAge = std::make_unique<systems::Age>();
     m_sysAnimatedSprite = std::make_unique<systems::AnimatedSprite>();
-    m_sysBirth = std::make_unique<systems::Birth>([this](std::shared_ptr<entities::Entity> entity)
+    m_sysBirth = std::make_unique<systems::Birth>(m_timers, [this](std::shared_ptr<entities::Entity> entity)
                                                   { this->onVirusBirth(entity); });
-    m_sysHealth = std::make_unique<systems::Health>();
-    m_sysLifetime = std::make_unique<systems::Lifetime>([this](entities::Entity::IdType entityId)
+    m_sysHealth = std::make_unique<systems::Health>(m_timers);
+    m_sysLifetime = std::make_unique<systems::Lifetime>(m_timers, [this](entities::Entity::IdType entityId)
                                                         { m_removeEntities.push_back(entityId); });
     m_sysPowerup = std::make_unique<systems::Powerup>(
+        m_timers,
         *m_level,
         [this](std::shared_ptr<entities::Powerup>& powerup)
         { m_newEntities.push_back(powerup); },
-        m_level->getKey());
+        m_level->getName());
     m_sysCollision = std::make_unique<systems::Collision>(
         [this](entities::Entity::IdType entityId)
         { m_removeEntities.push_back(entityId); },
@@ -149,6 +176,14 @@ void GameModel::initialize()
     m_sysRendererSarsCov2 = std::make_unique<systems::RendererVirus>();
     m_sysRendererParticleSystem = std::make_unique<systems::RendererParticleSystem>();
 
+    //
+    // Effects reference textures, so they can only be compiled once the content is ready
+    m_effectVirusDeath = systems::compileEffect(config::EFFECT_VIRUS_DEATH);
+    m_effectPlayerDeath = systems::compileEffect(config::EFFECT_PLAYER_DEATH);
+    m_effectPlayerStart = systems::compileEffect(config::EFFECT_PLAYER_START);
+    // All bullets are the same size, and this is just a reference point for creating the virus death effect anyway.
+    m_bulletSize = Configuration::getSnapshot().weapon(config::WeaponName::BasicGun).size;
+
     for (auto&& virus : m_level->initializeViruses())
     {
         onVirusBirth(virus);
@@ -167,6 +202,8 @@ void GameModel::initialize()
         Content::get<sf::Music>(m_level->getBackgroundMusicKey())->setLoop(true);
         Content::get<sf::Music>(m_level->getBackgroundMusicKey())->play();
     }
+
+    return true;
 }
 
 // --------------------------------------------------------------
@@ -197,15 +234,10 @@ void GameModel::update(const std::chrono::microseconds elapsedTime)
     m_updatePlayer(elapsedTime);
 
     m_sysParticle->update(elapsedTime);
-    m_sysLifetime->update(elapsedTime);
+    // Fires the Lifetime, Birth, Health, and Powerup events that have come due
+    m_timers.advance(elapsedTime);
     m_sysMovement->update(elapsedTime);
-
-    // It isn't absolutely essential to the overall game, but the age should be updated
-    // before Birth because age is used in the gestation determination in the Birth system.
     m_sysAge->update(elapsedTime);
-    m_sysBirth->update(elapsedTime);
-    m_sysHealth->update(elapsedTime);
-    m_sysPowerup->update(elapsedTime);
     m_sysAnimatedSprite->update(elapsedTime);
     m_sysCollision->update(elapsedTime);
 
@@ -282,16 +314,23 @@ void GameModel::removeDeadEntities()
 // All rendering takes place here.
 //
 // --------------------------------------------------------------
-void GameModel::render(sf::RenderTarget& renderTarget, const std::chrono::microseconds elapsedTime)
+void GameModel::render(renderers::RenderFrame& renderTarget, const std::chrono::microseconds elapsedTime)
 {
     renderTarget.clear(sf::Color::Black);
     m_rendererBackground->render(renderTarget);
     m_rendererHUD->render(m_remainingNanoBots + 1, m_timePlayed, m_virusesKilled, renderTarget);
     m_rendererStatus->render(renderTarget);
 
-    m_sysRendererAnimatedSprite->update(elapsedTime, renderTarget);
-    m_sysRendererSarsCov2->update(elapsedTime, renderTarget);
-    m_sysRendererSprite->update(elapsedTime, renderTarget);
+    //
+    // Viruses (and their bullets), powerups, bullets, bombs, and the player all go
+    // into the same batch.  With their textures in the atlas, that is one draw call.
+    m_spriteBatch.clear();
+    m_spriteBatch.setView(renderTarget.getView());
+    m_sysRendererSarsCov2->update(elapsedTime, m_spriteBatch);
+    m_sysRendererAnimatedSprite->update(elapsedTime, m_spriteBatch);
+    m_sysRendererSprite->update(elapsedTime, m_spriteBatch);
+    m_spriteBatch.render(renderTarget);
+
     m_sysRendererParticleSystem->update(*m_sysParticle, renderTarget);
 }
 
@@ -307,21 +346,12 @@ void GameModel::onVirusDeath(entities::Entity* virus)
     auto position = virus->getComponent<components::Position>();
     auto size = virus->getComponent<components::Size>();
 
-    std::uint16_t howMany = virus->getComponent<components::Bullets>()->howMany() * 5;
-    m_sysParticle->addEffect(std::make_unique<systems::CircleExpansionEffect>(content::KEY_IMAGE_SARSCOV2_PARTICLE, position->get(), 0.0f, howMany, 0.00002f, 1.0f, 0.2f, misc::msTous(std::chrono::milliseconds(1000))));
-    m_sysParticle->addEffect(std::make_unique<systems::CircleExpansionEffect>(content::KEY_IMAGE_SARSCOV2_PARTICLE, position->get(), size->getInnerRadius() / 2.0f, howMany, 0.0000075f, 1.0f, 0.2f, misc::msTous(std::chrono::milliseconds(1000))));
-    //
-    // Time these so they finish just before the center
-    auto lifetime = misc::msTous(std::chrono::milliseconds(1500));
-    auto speed = -size->getInnerRadius() / lifetime.count();
-    // All bullets are the same size, and this is just a reference point for creating the particle effect anyway.
-    config::config_path WEAPON_ITEM_SIZE = { config::DOM_ENTITY, config::ENTITY_WEAPON_BASIC_GUN, config::DOM_SIZE };
-    auto bulletSize = Configuration::get<float>(WEAPON_ITEM_SIZE);
-    m_sysParticle->addEffect(std::make_unique<systems::CircleExpansionEffect>(content::KEY_IMAGE_BASIC_GUN_BULLET, position->get(), size->getInnerRadius(), virus->getComponent<components::Bullets>()->howMany(), speed, bulletSize, bulletSize / 2.0f, lifetime));
-
-    //
-    // One particle for the virus itself slowly going away
-    m_sysParticle->addEffect(std::make_unique<systems::CircleExpansionEffect>(content::KEY_IMAGE_SARSCOV2, position->get(), 0.0f, static_cast<std::uint16_t>(1), 0.0f, size->getOuterRadius(), 0.01f, lifetime));
+    systems::EffectParameters parameters(position->get());
+    parameters.set(systems::EffectParameter::Bullets, virus->getComponent<components::Bullets>()->howMany());
+    parameters.set(systems::EffectParameter::InnerRadius, size->getInnerRadius());
+    parameters.set(systems::EffectParameter::OuterRadius, size->getOuterRadius());
+    parameters.set(systems::EffectParameter::BulletSize, m_bulletSize);
+    m_sysParticle->addEffect(std::make_unique<systems::EmitterEffect>(m_effectVirusDeath, parameters));
 
     m_virusesKilled++;
     m_virusCount--;
@@ -352,17 +382,11 @@ void GameModel::onPlayerDeath()
     SoundPlayer::play(content::KEY_AUDIO_PLAYER_DEATH);
 
     auto position = m_player->getComponent<components::Position>();
-    auto howMany = static_cast<std::uint16_t>(100);
-    m_sysParticle->addEffect(std::make_unique<systems::CircleExpansionEffect>(content::KEY_IMAGE_PLAYER_PARTICLE, position->get(), 0.0f, howMany, 0.00002f, 1.0f, 0.05f, misc::msTous(std::chrono::milliseconds(500))));
-    m_sysParticle->addEffect(std::make_unique<systems::CircleExpansionEffect>(content::KEY_IMAGE_PLAYER_PARTICLE, position->get(), 0.0f, howMany, 0.00001f, 1.0f, 0.05f, misc::msTous(std::chrono::milliseconds(750))));
-    m_sysParticle->addEffect(std::make_unique<systems::CircleExpansionEffect>(content::KEY_IMAGE_PLAYER_PARTICLE, position->get(), 0.0f, howMany, 0.000005f, 1.0f, 0.05f, misc::msTous(std::chrono::milliseconds(1000))));
-    m_sysParticle->addEffect(std::make_unique<systems::CircleExpansionEffect>(content::KEY_IMAGE_PLAYER_PARTICLE, position->get(), 0.0f, howMany, 0.0000025f, 1.0f, 0.05f, misc::msTous(std::chrono::milliseconds(1250))));
-
-    //
-    // One particle for the player's ship slowly going away
     auto size = m_player->getComponent<components::Size>();
-    auto orientation = m_player->getComponent<components::Orientation>()->get();
-    m_sysParticle->addEffect(std::make_unique<systems::CircleExpansionEffect>(content::KEY_IMAGE_PLAYER, position->get(), 0.0f, 0.0f, size->getOuterRadius(), 0.01f, orientation, misc::msTous(std::chrono::milliseconds(2000))));
+    systems::EffectParameters parameters(position->get());
+    parameters.set(systems::EffectParameter::OuterRadius, size->getOuterRadius());
+    parameters.set(systems::EffectParameter::Orientation, m_player->getComponent<components::Orientation>()->get());
+    m_sysParticle->addEffect(std::make_unique<systems::EmitterEffect>(m_effectPlayerDeath, parameters));
 
     unregisterInputHandlers();
     m_removeEntities.push_back(m_player->getId());
@@ -481,54 +505,60 @@ void GameModel::startPlayer(math::Point2f position)
     };
 
     // Particle effect as a visual cue to show where the player starts
-    m_sysParticle->addEffect(std::make_unique<systems::PlayerStartEffect>(
-        m_player->getComponent<components::Position>()->get(),
-        static_cast<std::uint16_t>(300), misc::msTous(std::chrono::milliseconds(750))));
+    m_sysParticle->addEffect(std::make_unique<systems::EmitterEffect>(
+        m_effectPlayerStart,
+        systems::EffectParameters(m_player->getComponent<components::Position>()->get())));
 }
 
 // --------------------------------------------------------------
 //
 // Get the content that is shared in common with all levels specified here.
+// It is only requested once, every level then waits on the same handle.
+// The group keeps it resident for as long as its owner is around.
 //
 // --------------------------------------------------------------
-void GameModel::loadContent()
+void GameModel::loadContent(Content::Group& group)
 {
-    Content::load<sf::Texture>(content::KEY_IMAGE_SARSCOV2, Configuration::get<std::string>(config::VIRUS_IMAGE), nullptr, nullptr);
-    Content::load<sf::Texture>(content::KEY_IMAGE_SARSCOV2_PARTICLE, Configuration::get<std::string>(config::VIRUS_PARTICLE), nullptr, nullptr);
-    Content::load<sf::Texture>(content::KEY_IMAGE_PLAYER, Configuration::get<std::string>(config::PLAYER_IMAGE), nullptr, nullptr);
-    Content::load<sf::Texture>(content::KEY_IMAGE_PLAYER_START_PARTICLE, Configuration::get<std::string>(config::PLAYER_START_PARTICLE), nullptr, nullptr);
-    Content::load<sf::Texture>(content::KEY_IMAGE_PLAYER_PARTICLE, Configuration::get<std::string>(config::PLAYER_PARTICLE), nullptr, nullptr);
-
-    Content::load<sf::SoundBuffer>(content::KEY_AUDIO_THRUST, Configuration::get<std::string>(config::PLAYER_AUDIO_THRUST), nullptr, nullptr);
-    Content::load<sf::SoundBuffer>(content::KEY_AUDIO_VIRUS_DEATH, Configuration::get<std::string>(config::AUDIO_DEATH), nullptr, nullptr);
-    Content::load<sf::SoundBuffer>(content::KEY_AUDIO_PLAYER_DEATH, Configuration::get<std::string>(config::PLAYER_AUDIO_DEATH), nullptr, nullptr);
-    Content::load<sf::SoundBuffer>(content::KEY_AUDIO_PLAYER_START, Configuration::get<std::string>(config::PLAYER_AUDIO_START), nullptr, nullptr);
-
-    Content::load<sf::Texture>(content::KEY_IMAGE_BASIC_GUN_BULLET, Configuration::get<std::string>(config::BASIC_GUN_IMAGE_BULLET), nullptr, nullptr);
-    Content::load<sf::Texture>(content::KEY_IMAGE_BOMB, Configuration::get<std::string>(config::BOMB_IMAGE), nullptr, nullptr);
-
-    Content::load<sf::SoundBuffer>(content::KEY_AUDIO_BASIC_GUN_FIRE, Configuration::get<std::string>(config::BASIC_GUN_AUDIO_FIRE), nullptr, nullptr);
-    Content::load<sf::SoundBuffer>(content::KEY_AUDIO_BOMB_FIRE, Configuration::get<std::string>(config::BOMB_AUDIO_FIRE), nullptr, nullptr);
-    Content::load<sf::SoundBuffer>(content::KEY_AUDIO_BOMB_EXPLODE, Configuration::get<std::string>(config::BOMB_AUDIO_EXPLODE), nullptr, nullptr);
-
-    Content::load<sf::Texture>(content::KEY_IMAGE_POWERUP_RAPID_FIRE, Configuration::get<std::string>(config::POWERUP_RAPID_FIRE_IMAGE), nullptr, nullptr);
-    Content::load<sf::Texture>(content::KEY_IMAGE_POWERUP_SPREAD_FIRE, Configuration::get<std::string>(config::POWERUP_SPREAD_FIRE_IMAGE), nullptr, nullptr);
-    Content::load<sf::Texture>(content::KEY_IMAGE_POWERUP_BOMB, Configuration::get<std::string>(config::POWERUP_BOMB_IMAGE), nullptr, nullptr);
-
-    Content::load<sf::SoundBuffer>(content::KEY_AUDIO_RAPID_GUN_POWERUP, Configuration::get<std::string>(config::POWERUP_RAPID_FIRE_AUDIO), nullptr, nullptr);
-    Content::load<sf::SoundBuffer>(content::KEY_AUDIO_SPREAD_GUN_POWERUP, Configuration::get<std::string>(config::POWERUP_SPREAD_FIRE_AUDIO), nullptr, nullptr);
-    Content::load<sf::SoundBuffer>(content::KEY_AUDIO_BOMB_POWERUP, Configuration::get<std::string>(config::POWERUP_BOMB_AUDIO), nullptr, nullptr);
+    std::vector<Content::Handle> common;
+
+    common.push_back(group.load<sf::Texture>(content::KEY_IMAGE_SARSCOV2, Configuration::get<std::string>(config::VIRUS_IMAGE)));
+    common.push_back(group.load<sf::Texture>(content::KEY_IMAGE_SARSCOV2_PARTICLE, Configuration::get<std::string>(config::VIRUS_PARTICLE)));
+    common.push_back(group.load<sf::Texture>(content::KEY_IMAGE_PLAYER, Configuration::get<std::string>(config::PLAYER_IMAGE)));
+    common.push_back(group.load<sf::Texture>(content::KEY_IMAGE_PLAYER_START_PARTICLE, Configuration::get<std::string>(config::PLAYER_START_PARTICLE)));
+    common.push_back(group.load<sf::Texture>(content::KEY_IMAGE_PLAYER_PARTICLE, Configuration::get<std::string>(config::PLAYER_PARTICLE)));
+
+    common.push_back(group.load<sf::SoundBuffer>(content::KEY_AUDIO_THRUST, Configuration::get<std::string>(config::PLAYER_AUDIO_THRUST)));
+    common.push_back(group.load<sf::SoundBuffer>(content::KEY_AUDIO_VIRUS_DEATH, Configuration::get<std::string>(config::AUDIO_DEATH)));
+    common.push_back(group.load<sf::SoundBuffer>(content::KEY_AUDIO_PLAYER_DEATH, Configuration::get<std::string>(config::PLAYER_AUDIO_DEATH)));
+    common.push_back(group.load<sf::SoundBuffer>(content::KEY_AUDIO_PLAYER_START, Configuration::get<std::string>(config::PLAYER_AUDIO_START)));
+
+    common.push_back(group.load<sf::Texture>(content::KEY_IMAGE_BASIC_GUN_BULLET, Configuration::get<std::string>(config::BASIC_GUN_IMAGE_BULLET)));
+    common.push_back(group.load<sf::Texture>(content::KEY_IMAGE_BOMB, Configuration::get<std::string>(config::BOMB_IMAGE)));
+
+    common.push_back(group.load<sf::SoundBuffer>(content::KEY_AUDIO_BASIC_GUN_FIRE, Configuration::get<std::string>(config::BASIC_GUN_AUDIO_FIRE)));
+    common.push_back(group.load<sf::SoundBuffer>(content::KEY_AUDIO_BOMB_FIRE, Configuration::get<std::string>(config::BOMB_AUDIO_FIRE)));
+    common.push_back(group.load<sf::SoundBuffer>(content::KEY_AUDIO_BOMB_EXPLODE, Configuration::get<std::string>(config::BOMB_AUDIO_EXPLODE)));
+
+    common.push_back(group.load<sf::Texture>(content::KEY_IMAGE_POWERUP_RAPID_FIRE, Configuration::get<std::string>(config::POWERUP_RAPID_FIRE_IMAGE)));
+    common.push_back(group.load<sf::Texture>(content::KEY_IMAGE_POWERUP_SPREAD_FIRE, Configuration::get<std::string>(config::POWERUP_SPREAD_FIRE_IMAGE)));
+    common.push_back(group.load<sf::Texture>(content::KEY_IMAGE_POWERUP_BOMB, Configuration::get<std::string>(config::POWERUP_BOMB_IMAGE)));
+
+    common.push_back(group.load<sf::SoundBuffer>(content::KEY_AUDIO_RAPID_GUN_POWERUP, Configuration::get<std::string>(config::POWERUP_RAPID_FIRE_AUDIO)));
+    common.push_back(group.load<sf::SoundBuffer>(content::KEY_AUDIO_SPREAD_GUN_POWERUP, Configuration::get<std::string>(config::POWERUP_SPREAD_FIRE_AUDIO)));
+    common.push_back(group.load<sf::SoundBuffer>(content::KEY_AUDIO_BOMB_POWERUP, Configuration::get<std::string>(config::POWERUP_BOMB_AUDIO)));
+
+    m_contentCommon = Content::whenAll(common);
 }
 
 // --------------------------------------------------------------
 //
 // Method that indicates whether or not all content for the level
-// is ready.
+// has finished loading, without waiting on it.
 //
 // --------------------------------------------------------------
 bool GameModel::contentReady()
 {
-    return (!Content::instance().isError() && !Content::instance().anyPending());
+    return m_content.isReady();
 }
 
 // --------------------------------------------------------------
@@ -27,9 +27,12 @@ THE SOFTWARE.
 #include "entities/Virus.hpp"
 #include "levels/Level.hpp"
 #include "levels/LevelName.hpp"
+#include "misc/TimingWheel.hpp"
 #include "renderers/Background.hpp"
 #include "renderers/GameStatus.hpp"
 #include "renderers/HUD.hpp"
+#include "renderers/SpriteBatch.hpp"
+#include "services/Content.hpp"
 #include "systems/Age.hpp"
 #include "systems/AnimatedSprite.hpp"
 #include "systems/Birth.hpp"
@@ -43,6 +46,7 @@ THE SOFTWARE.
 #include "systems/RendererParticleSystem.hpp"
 #include "systems/RendererSprite.hpp"
 #include "systems/RendererVirus.hpp"
+#include "systems/effects/EffectProgram.hpp"
 
 #include <SFML/Audio/Sound.hpp>
 #include <SFML/Graphics.hpp>
@@ -59,22 +63,29 @@ class GameModel
     GameModel();
 
     static void selectLevel(levels::LevelName whichLevel);
-    static void loadContent();
+    static void prefetchLevel(levels::LevelName whichLevel);
+    static void loadContent(Content::Group& group);
 
-    void initialize();
+    bool initialize();
     void shutdown();
+    bool contentReady();
 
     void update(const std::chrono::microseconds elapsedTime);
-    void render(sf::RenderTarget& renderTarget, const std::chrono::microseconds elapsedTime);
+    void render(renderers::RenderFrame& renderTarget, const std::chrono::microseconds elapsedTime);
 
   private:
     static levels::LevelName m_levelSelect;
     static std::atomic_bool m_contentError;
+    static Content::Handle m_contentCommon;
+
+    Content::Handle m_content;
 
     std::unique_ptr<levels::Level> m_level{ nullptr };
     std::chrono::milliseconds m_timePlayed{ 0 };
     std::uint32_t m_virusesKilled{ 0 };
 
+    TimingWheel m_timers; // Timed component events, advanced with the simulation
+
     std::unique_ptr<systems::Movement> m_sysMovement;
     std::unique_ptr<systems::Lifetime> m_sysLifetime;
     std::unique_ptr<systems::Birth> m_sysBirth;
@@ -89,6 +100,11 @@ class GameModel
     std::unique_ptr<systems::RendererVirus> m_sysRendererSarsCov2;
     std::unique_ptr<systems::RendererParticleSystem> m_sysRendererParticleSystem;
 
+    std::shared_ptr<const systems::EffectProgram> m_effectVirusDeath;
+    std::shared_ptr<const systems::EffectProgram> m_effectPlayerDeath;
+    std::shared_ptr<const systems::EffectProgram> m_effectPlayerStart;
+    float m_bulletSize{ 0.0f };
+
     std::shared_ptr<entities::Player> m_player{ nullptr };
     std::uint8_t m_remainingNanoBots{ 0 };
     std::uint16_t m_virusCount{ 0 };
@@ -98,6 +114,7 @@ class GameModel
     std::unique_ptr<renderers::Background> m_rendererBackground;
     std::unique_ptr<renderers::HUD> m_rendererHUD;
     std::unique_ptr<renderers::GameStatus> m_rendererStatus;
+    renderers::SpriteBatch m_spriteBatch;
 
     std::function<void(std::chrono::microseconds)> m_updatePlayer;
     std::chrono::microseconds m_playerStartCountdown{ 0 };
@@ -110,6 +127,5 @@ class GameModel
     void addNewEntities();
     void removeDeadEntities();
 
-    bool contentReady();
     void unregisterInputHandlers();
 };
@@ -23,6 +23,7 @@ THE SOFTWARE.
 #pragma once
 
 #include "misc/math.hpp"
+#include "renderers/RenderFrame.hpp"
 
 #include <SFML/Graphics.hpp>
 #include <chrono>
@@ -55,7 +56,7 @@ namespace ui
         virtual void onMouseReleased([[maybe_unused]] sf::Mouse::Button button, [[maybe_unused]] math::Point2f point, [[maybe_unused]] std::chrono::microseconds elapsedTime){};
 
         virtual void update([[maybe_unused]] const std::chrono::microseconds elapsedTime, [[maybe_unused]] const std::chrono::system_clock::time_point now){};
-        virtual void render([[maybe_unused]] sf::RenderTarget& renderTarget){};
+        virtual void render([[maybe_unused]] renderers::RenderFrame& renderTarget){};
 
         virtual void setActive() {}
         virtual void setInactive() {}
@@ -107,7 +107,7 @@ namespace ui
         m_expectingInput = true;
     }
 
-    void KeyboardOption::render(sf::RenderTarget& renderTarget)
+    void KeyboardOption::render(renderers::RenderFrame& renderTarget)
     {
         if (m_visible)
         {
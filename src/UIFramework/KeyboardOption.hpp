@@ -47,7 +47,7 @@ namespace ui
 
         virtual void onKeyPressed(sf::Keyboard::Key key);
         virtual void onMouseReleased(sf::Mouse::Button button, math::Point2f point, const std::chrono::microseconds elapsedTime) override;
-        virtual void render(sf::RenderTarget& renderTarget) override;
+        virtual void render(renderers::RenderFrame& renderTarget) override;
 
         virtual void setActive() override;
         virtual void setInactive() override;
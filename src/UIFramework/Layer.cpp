@@ -0,0 +1,169 @@
+/*
+Copyright (c) 2021 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+#include "Layer.hpp"
+
+#include "services/Configuration.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ui
+{
+    // --------------------------------------------------------------
+    //
+    // If the layer has been invalidated, its contents are drawn (using
+    // 'draw') into the next render texture, which is first grown to cover
+    // them if it doesn't already.  Either way, the layer is then added to
+    // the frame as a single sprite.
+    //
+    // --------------------------------------------------------------
+    void Layer::render(renderers::RenderFrame& renderTarget, const DrawFunction& draw)
+    {
+        if (!m_ready)
+        {
+            draw(renderTarget);
+            return;
+        }
+
+        if (m_dirty)
+        {
+            m_frame.reset(sf::View());
+            draw(m_frame);
+            //
+            // Only what is inside the view can be seen, so that is all the texture needs to cover
+            auto coords = Configuration::getGraphics().getViewCoordinates();
+            sf::FloatRect bounds;
+            m_empty = !m_frame.getBounds().intersects({ -coords.width / 2, -coords.height / 2, coords.width, coords.height }, bounds) ||
+                      bounds.width <= 0.0f || bounds.height <= 0.0f;
+            m_dirty = false;
+            if (m_empty)
+            {
+                return;
+            }
+
+            m_current = (m_current + 1) % m_textures.size();
+            if (!fit(m_current, bounds))
+            {
+                m_ready = false;
+                draw(renderTarget);
+                return;
+            }
+
+            auto& texture = m_textures[m_current];
+            m_frame.setView(texture.getView());
+            texture.clear(sf::Color::Transparent);
+            m_frame.render(texture);
+            texture.display();
+
+            auto& covered = m_bounds[m_current];
+            m_sprite.setTexture(texture.getTexture(), true);
+            m_sprite.setPosition({ covered.left, covered.top });
+            m_sprite.setScale({ covered.width / texture.getSize().x, covered.height / texture.getSize().y });
+        }
+
+        if (m_empty)
+        {
+            return;
+        }
+        //
+        // What was drawn into the texture was already blended against transparent, so
+        // its colors are premultiplied by alpha; blend it that way to avoid darkening
+        // anything that is partly transparent.
+        renderTarget.draw(m_sprite, sf::BlendMode(sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha));
+    }
+
+    // --------------------------------------------------------------
+    //
+    // The textures are created again on the next render.  This only happens
+    // when the window has been recreated, along with a new render thread, so
+    // no frame being presented can still be referring to them.
+    //
+    // --------------------------------------------------------------
+    void Layer::reset()
+    {
+        m_ready = true;
+        m_dirty = true;
+        m_bounds = {};
+    }
+
+    // --------------------------------------------------------------
+    //
+    // Makes sure the texture covers 'bounds'.  It is only created again if
+    // it doesn't already, and then to cover both what it did and the new
+    // bounds, so contents that move around a little (a menu item changing
+    // size as it is highlighted) settle on one size.  The covered area is
+    // snapped to window pixels, so the layer looks the same as drawing its
+    // contents directly.
+    //
+    // --------------------------------------------------------------
+    bool Layer::fit(std::size_t which, sf::FloatRect bounds)
+    {
+        auto& covered = m_bounds[which];
+        auto contains = [](const sf::FloatRect& outer, const sf::FloatRect& inner)
+        {
+            return inner.left >= outer.left && inner.top >= outer.top &&
+                   inner.left + inner.width <= outer.left + outer.width &&
+                   inner.top + inner.height <= outer.top + outer.height;
+        };
+        if (covered.width > 0.0f && contains(covered, bounds))
+        {
+            return true;
+        }
+
+        float left = bounds.left;
+        float top = bounds.top;
+        float right = bounds.left + bounds.width;
+        float bottom = bounds.top + bounds.height;
+        if (covered.width > 0.0f)
+        {
+            left = std::min(left, covered.left);
+            top = std::min(top, covered.top);
+            right = std::max(right, covered.left + covered.width);
+            bottom = std::max(bottom, covered.top + covered.height);
+        }
+
+        //
+        // The view is centered on 0, 0, so pixels are counted from its top left corner
+        auto resolution = Configuration::getGraphics().getResolution();
+        auto coords = Configuration::getGraphics().getViewCoordinates();
+        float pixelsX = resolution.width / coords.width;
+        float pixelsY = resolution.height / coords.height;
+        auto x0 = std::max(0.0f, std::floor((left + coords.width / 2) * pixelsX));
+        auto y0 = std::max(0.0f, std::floor((top + coords.height / 2) * pixelsY));
+        auto x1 = std::min(static_cast<float>(resolution.width), std::ceil((right + coords.width / 2) * pixelsX));
+        auto y1 = std::min(static_cast<float>(resolution.height), std::ceil((bottom + coords.height / 2) * pixelsY));
+        if (x1 <= x0 || y1 <= y0)
+        {
+            return false;
+        }
+
+        auto& texture = m_textures[which];
+        if (!texture.create(static_cast<unsigned int>(x1 - x0), static_cast<unsigned int>(y1 - y0)))
+        {
+            return false;
+        }
+        covered = { x0 / pixelsX - coords.width / 2, y0 / pixelsY - coords.height / 2, (x1 - x0) / pixelsX, (y1 - y0) / pixelsY };
+        texture.setView(sf::View(covered));
+
+        return true;
+    }
+} // namespace ui
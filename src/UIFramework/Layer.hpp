@@ -0,0 +1,72 @@
+/*
+Copyright (c) 2021 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "renderers/RenderFrame.hpp"
+
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cstddef>
+#include <functional>
+
+namespace ui
+{
+    // --------------------------------------------------------------
+    //
+    // A retained layer of the user interface.  Whatever is drawn into
+    // the layer is rasterized into a render texture that covers only the
+    // bounds of what was drawn, at the resolution of the window, and from
+    // then on the layer is drawn as a single sprite, until it is
+    // invalidated because something in it has changed.
+    //
+    // Two render textures are used in turn, so the one being redrawn is
+    // never the one the render thread may still be presenting from.  A
+    // texture is only created again when the contents grow past what it
+    // covers; if it can't be created, the layer simply draws its contents
+    // every frame.  When the window changes size, reset the layer so they
+    // are created again at the new resolution.
+    //
+    // --------------------------------------------------------------
+    class Layer
+    {
+      public:
+        using DrawFunction = std::function<void(renderers::RenderFrame&)>;
+
+        void invalidate() { m_dirty = true; }
+        void reset();
+        void render(renderers::RenderFrame& renderTarget, const DrawFunction& draw);
+
+      private:
+        bool m_ready{ true };
+        bool m_dirty{ true };
+        bool m_empty{ true };
+
+        std::array<sf::RenderTexture, 2> m_textures;
+        std::array<sf::FloatRect, 2> m_bounds; // What each texture covers, in view coordinates
+        std::size_t m_current{ 0 };
+        sf::Sprite m_sprite;
+        renderers::RenderFrame m_frame;
+
+        bool fit(std::size_t which, sf::FloatRect bounds);
+    };
+} // namespace ui
@@ -68,7 +68,7 @@ namespace ui
         }
     }
 
-    void MenuItem::render(sf::RenderTarget& renderTarget)
+    void MenuItem::render(renderers::RenderFrame& renderTarget)
     {
         if (this->isVisible())
         {
@@ -52,7 +52,7 @@ namespace ui
 
         virtual void onMouseReleased(sf::Mouse::Button button, math::Point2f point, const std::chrono::microseconds elapsedTime) override;
 
-        virtual void render(sf::RenderTarget& renderTarget) override;
+        virtual void render(renderers::RenderFrame& renderTarget) override;
         virtual void setRegion(const math::Rectangle2f& region) override;
 
         virtual void setActive() override;
@@ -83,7 +83,7 @@ namespace ui
         }
     }
 
-    void Selection::render(sf::RenderTarget& renderTarget)
+    void Selection::render(renderers::RenderFrame& renderTarget)
     {
         if (this->isVisible())
         {
@@ -24,16 +24,84 @@ THE SOFTWARE.
 
 #include "services/Configuration.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <set>
+#include <tuple>
+
 namespace ui
 {
+    // --------------------------------------------------------------
+    //
+    // A font builds its glyph atlas for a character size as glyphs are
+    // first asked for.  The first time a font, size, and outline is seen,
+    // all the printable characters are put into the atlas up front, so
+    // the atlas is complete before any text using it is drawn, rather
+    // than being added to (and possibly resized) while the render thread
+    // is drawing from it.
+    //
+    // --------------------------------------------------------------
+    static void prepareGlyphs(const sf::Font& font, unsigned int fontSize, float outlineThickness)
+    {
+        static std::set<std::tuple<const sf::Font*, unsigned int, float>> prepared;
+
+        if (prepared.insert({ &font, fontSize, outlineThickness }).second)
+        {
+            for (sf::Uint32 codePoint = ' '; codePoint <= '~'; codePoint++)
+            {
+                font.getGlyph(codePoint, fontSize, false);
+                if (outlineThickness != 0)
+                {
+                    font.getGlyph(codePoint, fontSize, false, outlineThickness);
+                }
+            }
+        }
+    }
+
+    // --------------------------------------------------------------
+    //
+    // Adds the two triangles for a glyph at the pen position (x, y).  This
+    // follows how sf::Text places its glyphs, so text looks the same as
+    // it did drawn through an sf::Text.
+    //
+    // --------------------------------------------------------------
+    static void addGlyph(std::vector<sf::Vertex>& vertices, math::Point2f position, math::Vector2f scale, float x, float y, const sf::Glyph& glyph, sf::Color color, float outlineThickness)
+    {
+        const float PADDING = 1.0f;
+
+        auto left = glyph.bounds.left - PADDING - outlineThickness;
+        auto top = glyph.bounds.top - PADDING - outlineThickness;
+        auto right = glyph.bounds.left + glyph.bounds.width + PADDING - outlineThickness;
+        auto bottom = glyph.bounds.top + glyph.bounds.height + PADDING - outlineThickness;
+
+        auto u1 = static_cast<float>(glyph.textureRect.left) - PADDING;
+        auto v1 = static_cast<float>(glyph.textureRect.top) - PADDING;
+        auto u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width) + PADDING;
+        auto v2 = static_cast<float>(glyph.textureRect.top + glyph.textureRect.height) + PADDING;
+
+        auto corner = [&](float cx, float cy)
+        {
+            return sf::Vector2f(position.x + (x + cx) * scale.x, position.y + (y + cy) * scale.y);
+        };
+        sf::Vertex topLeft(corner(left, top), color, { u1, v1 });
+        sf::Vertex topRight(corner(right, top), color, { u2, v1 });
+        sf::Vertex bottomRight(corner(right, bottom), color, { u2, v2 });
+        sf::Vertex bottomLeft(corner(left, bottom), color, { u1, v2 });
+
+        vertices.push_back(topLeft);
+        vertices.push_back(topRight);
+        vertices.push_back(bottomLeft);
+        vertices.push_back(bottomLeft);
+        vertices.push_back(topRight);
+        vertices.push_back(bottomRight);
+    }
+
     Text::Text(float left, float top, const std::string text, std::shared_ptr<sf::Font> font, sf::Color color, unsigned int fontSize) :
-        Element({ left, top, 0, 0 })
+        Element({ left, top, 0, 0 }),
+        m_font(font),
+        m_fontSize(fontSize),
+        m_fillColor(color)
     {
-        m_text.setPosition({ left, top });
-        m_text.setFont(*font);
-        m_text.setCharacterSize(fontSize);
-        m_text.setFillColor(color);
-        m_text.scale(Configuration::getGraphics().getScaleUI());
         //
         // Set the text string last, so the bounds of the element are set based on
         // the font, font size, etc settings.
@@ -41,10 +109,14 @@ namespace ui
     }
 
     Text::Text(float left, float top, const std::string text, std::shared_ptr<sf::Font> font, sf::Color fillColor, sf::Color outlineColor, unsigned int fontSize) :
-        Text(left, top, text, font, fillColor, fontSize)
+        Element({ left, top, 0, 0 }),
+        m_font(font),
+        m_fontSize(fontSize),
+        m_fillColor(fillColor),
+        m_outlineColor(outlineColor),
+        m_outlineThickness(1.1f)
     {
-        m_text.setOutlineColor(outlineColor);
-        m_text.setOutlineThickness(1.1f);
+        setText(text);
     }
 
     Text::Text(const std::string text, std::shared_ptr<sf::Font> font, sf::Color fillColor, unsigned int fontSize) :
@@ -56,23 +128,151 @@ namespace ui
     {
     }
 
-    void Text::render(sf::RenderTarget& renderTarget)
+    void Text::render(renderers::RenderFrame& renderTarget)
     {
-        if (m_visible)
+        if (m_visible && !m_vertices.empty())
         {
-            renderTarget.draw(m_text);
+            renderTarget.draw(m_vertices.data(), m_vertices.size(), sf::Triangles, sf::RenderStates(&m_font->getTexture(m_fontSize)));
         }
     }
 
+    // --------------------------------------------------------------
+    //
+    // Moving the text doesn't need it laid out again, the quads are
+    // only shifted to the new position.
+    //
+    // --------------------------------------------------------------
     void Text::setPosition(const math::Point2f& corner)
     {
+        auto dx = corner.x - m_region.left;
+        auto dy = corner.y - m_region.top;
         Element::setPosition(corner);
-        m_text.setPosition({ corner.x, corner.y });
+
+        for (auto&& vertex : m_vertices)
+        {
+            vertex.position.x += dx;
+            vertex.position.y += dy;
+        }
+    }
+
+    void Text::setFillColor(sf::Color color)
+    {
+        m_fillColor = color;
+        std::for_each(m_vertices.begin() + m_outlineVertexCount, m_vertices.end(), [color](auto& vertex)
+                      { vertex.color = color; });
+    }
+
+    void Text::setOutlineColor(sf::Color color)
+    {
+        m_outlineColor = color;
+        std::for_each(m_vertices.begin(), m_vertices.begin() + m_outlineVertexCount, [color](auto& vertex)
+                      { vertex.color = color; });
     }
 
     void Text::setText(const std::string text)
     {
-        m_text.setString(text);
-        setRegion({ m_region.left, m_region.top, m_text.getGlobalBounds().width, m_text.getGlobalBounds().height });
+        m_string = text;
+        layout();
+    }
+
+    // --------------------------------------------------------------
+    //
+    // Lays the string out into glyph quads and updates the region of the
+    // element to its bounds.  The pen movement (kerning, whitespace) and
+    // bounds follow sf::Text, scaled by the UI scale.
+    //
+    // --------------------------------------------------------------
+    void Text::layout()
+    {
+        prepareGlyphs(*m_font, m_fontSize, m_outlineThickness);
+
+        auto position = math::Point2f(m_region.left, m_region.top);
+        auto scale = Configuration::getGraphics().getScaleUI();
+        auto whitespaceWidth = m_font->getGlyph(' ', m_fontSize, false).advance;
+        auto lineSpacing = m_font->getLineSpacing(m_fontSize);
+
+        m_vertices.clear();
+        std::vector<sf::Vertex> fill;
+
+        auto x = 0.0f;
+        auto y = static_cast<float>(m_fontSize);
+        auto minX = static_cast<float>(m_fontSize);
+        auto minY = static_cast<float>(m_fontSize);
+        auto maxX = 0.0f;
+        auto maxY = 0.0f;
+        sf::Uint32 previous = 0;
+        for (auto&& c : m_string)
+        {
+            auto current = static_cast<sf::Uint32>(static_cast<unsigned char>(c));
+            if (current == '\r')
+            {
+                continue;
+            }
+            x += m_font->getKerning(previous, current, m_fontSize);
+            previous = current;
+
+            if (current == ' ' || current == '\t' || current == '\n')
+            {
+                minX = std::min(minX, x);
+                minY = std::min(minY, y);
+                switch (current)
+                {
+                    case ' ':
+                        x += whitespaceWidth;
+                        break;
+                    case '\t':
+                        x += whitespaceWidth * 4;
+                        break;
+                    case '\n':
+                        y += lineSpacing;
+                        x = 0;
+                        break;
+                }
+                maxX = std::max(maxX, x);
+                maxY = std::max(maxY, y);
+                continue;
+            }
+
+            if (m_outlineThickness != 0)
+            {
+                auto& glyph = m_font->getGlyph(current, m_fontSize, false, m_outlineThickness);
+                addGlyph(m_vertices, position, scale, x, y, glyph, m_outlineColor, m_outlineThickness);
+
+                minX = std::min(minX, x + glyph.bounds.left - m_outlineThickness);
+                maxX = std::max(maxX, x + glyph.bounds.left + glyph.bounds.width - m_outlineThickness);
+                minY = std::min(minY, y + glyph.bounds.top - m_outlineThickness);
+                maxY = std::max(maxY, y + glyph.bounds.top + glyph.bounds.height - m_outlineThickness);
+            }
+
+            auto& glyph = m_font->getGlyph(current, m_fontSize, false);
+            addGlyph(fill, position, scale, x, y, glyph, m_fillColor, 0.0f);
+            if (m_outlineThickness == 0)
+            {
+                minX = std::min(minX, x + glyph.bounds.left);
+                maxX = std::max(maxX, x + glyph.bounds.left + glyph.bounds.width);
+                minY = std::min(minY, y + glyph.bounds.top);
+                maxY = std::max(maxY, y + glyph.bounds.top + glyph.bounds.height);
+            }
+
+            x += glyph.advance;
+        }
+
+        if (m_outlineThickness != 0)
+        {
+            auto outline = std::abs(std::ceil(m_outlineThickness));
+            minX -= outline;
+            maxX += outline;
+            minY -= outline;
+            maxY += outline;
+        }
+
+        m_outlineVertexCount = m_vertices.size();
+        m_vertices.insert(m_vertices.end(), fill.begin(), fill.end());
+
+        if (m_string.empty())
+        {
+            minX = minY = maxX = maxY = 0.0f;
+        }
+        setRegion({ m_region.left, m_region.top, (maxX - minX) * scale.x, (maxY - minY) * scale.y });
     }
 } // namespace ui
@@ -26,9 +26,11 @@ THE SOFTWARE.
 
 #include <SFML/Graphics/Color.hpp>
 #include <SFML/Graphics/Font.hpp>
-#include <SFML/Graphics/Text.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <cstddef>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace ui
 {
@@ -38,6 +40,12 @@ namespace ui
     // on a single line, this isn't some fancy pants proportional
     // rendering jobbie.
     //
+    // The string is laid out into glyph quads only when it (or its font
+    // settings) changes.  The quads refer to the glyph atlas the font
+    // keeps for each character size, so all text using the same font
+    // and size shares one texture, and text rendered back to back is
+    // drawn in a single batch.
+    //
     // --------------------------------------------------------------
     class Text : public Element
     {
@@ -47,14 +55,25 @@ namespace ui
         Text(const std::string text, std::shared_ptr<sf::Font> font, sf::Color fillColor, unsigned int fontSize);
         Text(const std::string text, std::shared_ptr<sf::Font> font, sf::Color fillColor, sf::Color outlineColor, unsigned int fontSize);
 
-        virtual void render(sf::RenderTarget& renderTarget) override;
+        virtual void render(renderers::RenderFrame& renderTarget) override;
         virtual void setPosition(const math::Point2f& corner) override;
 
-        inline void setFillColor(sf::Color color) { m_text.setFillColor(color); }
-        inline void setOutlineColor(sf::Color color) { m_text.setOutlineColor(color); }
+        void setFillColor(sf::Color color);
+        void setOutlineColor(sf::Color color);
         void setText(const std::string text);
+        void updateScale() { layout(); } // The UI scale has changed, so the glyph quads have to be laid out again
 
       private:
-        sf::Text m_text;
+        std::shared_ptr<sf::Font> m_font;
+        unsigned int m_fontSize;
+        sf::Color m_fillColor;
+        sf::Color m_outlineColor{ sf::Color::Black };
+        float m_outlineThickness{ 0.0f };
+        std::string m_string;
+
+        std::vector<sf::Vertex> m_vertices; // Outline quads first (if any), then the fill quads
+        std::size_t m_outlineVertexCount{ 0 };
+
+        void layout();
     };
-} // namespace ui
\ No newline at end of file
+} // namespace ui
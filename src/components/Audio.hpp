@@ -33,7 +33,7 @@ namespace components
     class Audio : public Component
     {
       public:
-        Audio(std::string audioKey, bool load = false) :
+        Audio(content::Key audioKey, bool load = false) :
             m_audioKey(audioKey)
         {
             //
@@ -50,7 +50,7 @@ namespace components
         void stop() { m_sound.stop(); }
 
       private:
-        std::string m_audioKey;
+        content::Key m_audioKey;
         sf::Sound m_sound;
     };
 } // namespace components
@@ -43,26 +43,9 @@ namespace components
         auto getGestationMin() { return m_gestationMin; }
         auto& getDistribution() { return m_distribution; }
 
-        auto getCurrentGestation() { return m_currentGestation; }
-        void setGestationTime(std::chrono::microseconds howLong)
-        {
-            m_currentGestation = howLong;
-            m_gestation = true;
-        }
-        void resetGestation() { m_gestation = false; }
-        bool isGestating() { return m_gestation; }
-
-        void update(std::chrono::microseconds elapsedTime)
-        {
-            if (m_gestation)
-                m_currentGestation -= elapsedTime;
-        }
-
       private:
         std::chrono::microseconds m_maturityAge;
         std::chrono::microseconds m_gestationMin;
-        std::chrono::microseconds m_currentGestation{ 0 };
-        bool m_gestation{ false };
 
         std::normal_distribution<double> m_distribution; // Yes, each component has its own distribution
     };
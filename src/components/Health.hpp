@@ -47,14 +47,9 @@ namespace components
         auto getRemainingIncrements() { return m_remainingIncrements; }
         auto subtractRemainingIncrements(std::uint8_t howMany) { m_remainingIncrements -= howMany; }
 
-        auto getElapsedIncrementTime() { return m_elapsedIncrementTime; }
-        void addElapsedIncrementTime(std::chrono::microseconds howMuch) { m_elapsedIncrementTime += howMuch; }
-        void subtractElapsedIncrementTime(std::chrono::microseconds howMuch) { m_elapsedIncrementTime -= howMuch; }
-
       private:
         std::int16_t m_health;                     // Setting this to a signed value so it can go negative
         std::int8_t m_remainingIncrements;         // How many increments to allow; signed for the same reason as above
         std::chrono::microseconds m_incrementTime; // 1 increment each X microseconds
-        std::chrono::microseconds m_elapsedIncrementTime{ 0 };
     };
 } // namespace components
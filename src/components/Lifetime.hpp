@@ -44,8 +44,6 @@ namespace components
         }
 
         auto get() { return m_lifetime; }
-        void update(std::chrono::microseconds elapsedTime) { m_lifetime -= elapsedTime; }
-        bool isAlive() { return m_lifetime.count() > 0; }
         void endOfLife() { m_endOfLife(); }
 
       private:
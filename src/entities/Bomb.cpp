@@ -44,13 +44,7 @@ namespace entities
 
     Bomb::Bomb(std::chrono::microseconds lifetime, float size, std::function<void(std::shared_ptr<entities::Entity>&)> emitBullet)
     {
-        using namespace std::string_literals;
-        using namespace config;
-
-        static const config_path BOMB_BULLET_COUNT = { DOM_ENTITY, ENTITY_WEAPON_BOMB, DOM_BULLETS, "count"s };
-        static const config_path BOMB_BULLET_DAMAGE = { DOM_ENTITY, ENTITY_WEAPON_BOMB, DOM_BULLETS, DOM_DAMAGE };
-        static const config_path BOMB_BULLET_SIZE = { DOM_ENTITY, ENTITY_WEAPON_BOMB, DOM_BULLETS, DOM_SIZE };
-        static const config_path BOMB_BULLET_LIFETIME = { DOM_ENTITY, ENTITY_WEAPON_BOMB, DOM_BULLETS, DOM_LIFETIME };
+        auto& bomb = Configuration::getSnapshot().bomb;
 
         this->addComponent(std::make_unique<components::Position>(math::Point2f(0.0f, 0.0f)));
         this->addComponent(std::make_unique<components::Size>(math::Dimension2f(size, size)));
@@ -60,10 +54,10 @@ namespace entities
         this->addComponent(std::make_unique<components::Sprite>(Content::get<sf::Texture>(content::KEY_IMAGE_BOMB)));
         this->addComponent(std::make_unique<components::Orientation>(0.0f));
         this->addComponent(std::make_unique<components::Bomb>(
-            Configuration::get<std::uint16_t>(BOMB_BULLET_COUNT),
-            Configuration::get<std::uint16_t>(BOMB_BULLET_DAMAGE),
-            Configuration::get<float>(BOMB_BULLET_SIZE),
-            misc::msTous(Configuration::get<std::chrono::milliseconds>(BOMB_BULLET_LIFETIME))));
+            bomb.bulletCount,
+            bomb.bulletDamage,
+            bomb.bulletSize,
+            bomb.bulletLifetime));
     }
 
     void Bomb::explode(std::function<void(std::shared_ptr<entities::Entity>&)> emitBullet)
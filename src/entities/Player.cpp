@@ -60,15 +60,16 @@ namespace entities
     std::shared_ptr<Player> Player::create()
     {
         Specification spec;
-        spec.thrustRate = Configuration::get<double>(config::PLAYER_THRUST_RATE);
-        spec.dragRate = Configuration::get<double>(config::PLAYER_DRAG_RATE) * misc::PER_MS_TO_US;
-        spec.rotateRate = Configuration::get<float>(config::PLAYER_ROTATE_RATE);
-        spec.maxSpeed = Configuration::get<float>(config::PLAYER_MAX_SPEED);
-        spec.size = Configuration::get<float>(config::PLAYER_SIZE);
+        auto& settings = Configuration::getSnapshot().player;
+        spec.thrustRate = settings.thrustRate;
+        spec.dragRate = settings.dragRate * misc::PER_MS_TO_US;
+        spec.rotateRate = settings.rotateRate;
+        spec.maxSpeed = settings.maxSpeed;
+        spec.size = settings.size;
 
         auto player = std::make_shared<Player>(spec);
 
-        player->attachPrimaryWeapon(std::make_shared<entities::WeaponGun>(config::ENTITY_WEAPON_BASIC_GUN));
+        player->attachPrimaryWeapon(std::make_shared<entities::WeaponGun>(config::WeaponName::BasicGun));
         player->attachSecondaryWeapon(std::make_shared<entities::WeaponEmpty>());
 
         return player;
@@ -116,19 +117,19 @@ namespace entities
         {
             case components::Powerup::Type::RapidFire:
             {
-                auto weapon = std::make_shared<WeaponRapidFire>(config::ENTITY_WEAPON_RAPID_FIRE);
+                auto weapon = std::make_shared<WeaponRapidFire>(config::WeaponName::RapidFire);
                 this->attachPrimaryWeapon(weapon);
             }
             break;
             case components::Powerup::Type::SpreadFire:
             {
-                auto weapon = std::make_shared<WeaponSpreadFire>(config::ENTITY_WEAPON_SPREAD_FIRE);
+                auto weapon = std::make_shared<WeaponSpreadFire>(config::WeaponName::SpreadFire);
                 this->attachPrimaryWeapon(weapon);
             }
             break;
             case components::Powerup::Type::Bomb:
             {
-                auto weapon = std::make_shared<WeaponBomb>(config::ENTITY_WEAPON_BOMB);
+                auto weapon = std::make_shared<WeaponBomb>(config::WeaponName::Bomb);
                 this->attachSecondaryWeapon(weapon);
             }
             break;
@@ -38,32 +38,38 @@ THE SOFTWARE.
 namespace entities
 {
 
-    Powerup::Powerup(components::Powerup::Type type, std::string key, math::Point2f position)
+    Powerup::Powerup(components::Powerup::Type type, config::WeaponName weapon, math::Point2f position)
     {
-        using namespace config;
-
-        const config_path POWERUP_IMAGE = { DOM_ENTITY, key, DOM_POWERUP, DOM_IMAGE };
-        const config_path POWERUP_AUDIO = { DOM_ENTITY, key, DOM_POWERUP, DOM_AUDIO };
-        const config_path POWERUP_SIZE = { DOM_ENTITY, key, DOM_POWERUP, DOM_SIZE };
-        const config_path POWERUP_LIFETIME = { DOM_ENTITY, key, DOM_POWERUP, DOM_LIFETIME };
-        const config_path POWERUP_SPRITE_COUNT = { DOM_ENTITY, key, DOM_POWERUP, DOM_SPRITE_COUNT };
-        const config_path POWERUP_SPRITE_TIME = { DOM_ENTITY, key, DOM_POWERUP, DOM_SPRITE_TIME };
-
         //
         // Powerups know how to read themselves from the configuration
-        std::string imageKey = "image/powerup-" + key;
+        auto imageKey = content::KEY_IMAGE_POWERUP_RAPID_FIRE;
+        auto audioKey = content::KEY_AUDIO_RAPID_GUN_POWERUP;
+        switch (type)
+        {
+            case components::Powerup::Type::RapidFire:
+                break;
+            case components::Powerup::Type::SpreadFire:
+                imageKey = content::KEY_IMAGE_POWERUP_SPREAD_FIRE;
+                audioKey = content::KEY_AUDIO_SPREAD_GUN_POWERUP;
+                break;
+            case components::Powerup::Type::Bomb:
+                imageKey = content::KEY_IMAGE_POWERUP_BOMB;
+                audioKey = content::KEY_AUDIO_BOMB_POWERUP;
+                break;
+        }
         auto texture = Content::get<sf::Texture>(imageKey);
 
-        auto spriteCount = Configuration::get<std::uint8_t>(POWERUP_SPRITE_COUNT);
-        auto lifetime = misc::msTous(Configuration::get<std::chrono::milliseconds>(POWERUP_LIFETIME));
-        auto size = Configuration::get<float>(POWERUP_SIZE);
-        auto spriteTime = misc::msTous(Configuration::get<std::chrono::milliseconds>(POWERUP_SPRITE_TIME));
+        auto& settings = Configuration::getSnapshot().powerup(weapon);
+        auto spriteCount = settings.spriteCount;
+        auto lifetime = settings.lifetime;
+        auto size = settings.size;
+        auto spriteTime = settings.spriteTime;
 
         this->addComponent(std::make_unique<components::Powerup>(type));
         this->addComponent(std::make_unique<components::Position>(position));
         this->addComponent(std::make_unique<components::Size>(math::Dimension2f(size, size)));
         this->addComponent(std::make_unique<components::Lifetime>(lifetime));
-        this->addComponent(std::make_unique<components::Audio>("audio/powerup-" + key));
+        this->addComponent(std::make_unique<components::Audio>(audioKey));
         this->addComponent(std::make_unique<components::AnimatedSprite>(texture, spriteCount, spriteTime));
         // Have to adjust the width dimension by the number of sprites in the image in
         // order for the rendering size to come out correctly.
@@ -26,9 +26,9 @@ THE SOFTWARE.
 #include "entities/Entity.hpp"
 #include "entities/Weapon.hpp"
 #include "misc/math.hpp"
+#include "services/ConfigurationSnapshot.hpp"
 
 #include <memory>
-#include <string>
 
 namespace entities
 {
@@ -42,6 +42,6 @@ namespace entities
       protected:
         // Declared as protected, because we don't want a class of this type to be created.  I know
         // it couldn't because of the 'get' method above, but I still feel better about doing this.
-        Powerup(components::Powerup::Type type, std::string key, math::Point2f position);
+        Powerup(components::Powerup::Type type, config::WeaponName weapon, math::Point2f position);
     };
 } // namespace entities
@@ -25,7 +25,7 @@ THE SOFTWARE.
 #include "Powerup.hpp"
 #include "components/Powerup.hpp"
 #include "misc/math.hpp"
-#include "services/ConfigurationPath.hpp"
+#include "services/ConfigurationSnapshot.hpp"
 
 namespace entities
 {
@@ -33,7 +33,7 @@ namespace entities
     {
       public:
         PowerupBomb(math::Point2f position) :
-            Powerup(components::Powerup::Type::Bomb, config::ENTITY_WEAPON_BOMB, position)
+            Powerup(components::Powerup::Type::Bomb, config::WeaponName::Bomb, position)
         {
         }
     };
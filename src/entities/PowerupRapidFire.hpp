@@ -25,7 +25,7 @@ THE SOFTWARE.
 #include "Powerup.hpp"
 #include "components/Powerup.hpp"
 #include "misc/math.hpp"
-#include "services/ConfigurationPath.hpp"
+#include "services/ConfigurationSnapshot.hpp"
 
 namespace entities
 {
@@ -33,7 +33,7 @@ namespace entities
     {
       public:
         PowerupRapidFire(math::Point2f position) :
-            Powerup(components::Powerup::Type::RapidFire, config::ENTITY_WEAPON_RAPID_FIRE, position)
+            Powerup(components::Powerup::Type::RapidFire, config::WeaponName::RapidFire, position)
         {
         }
     };
@@ -86,17 +86,18 @@ namespace entities
     Virus::Specification Virus::readConfiguration()
     {
         Virus::Specification spec;
-
-        spec.minSize = Configuration::get<float>(config::VIRUS_SIZE_MIN);
-        spec.maxSize = Configuration::get<float>(config::VIRUS_SIZE_MAX);
-        spec.maxAge = misc::msTous(std::chrono::milliseconds(Configuration::get<std::uint32_t>(config::VIRUS_AGE_MATURITY)));
-        spec.healthStart = Configuration::get<std::uint16_t>(config::VIRUS_HEALTH_START);
-        spec.healthIncrements = Configuration::get<std::uint8_t>(config::VIRUS_HEALTH_INCREMENTS);
-        spec.healthIncrementTime = misc::msTous(std::chrono::milliseconds(Configuration::get<std::uint32_t>(config::VIRUS_HEALTH_INCREMENT_TIME)));
-        spec.gestationMin = misc::msTous(std::chrono::milliseconds(Configuration::get<std::uint32_t>(config::VIRUS_GEST_MIN)));
-        spec.gestationMean = misc::msTous(std::chrono::milliseconds(Configuration::get<std::uint32_t>(config::VIRUS_GEST_MEAN)));
-        spec.gestationStdev = misc::msTous(std::chrono::milliseconds(Configuration::get<std::uint32_t>(config::VIRUS_GEST_STDEV)));
-        spec.rotateRate = Configuration::get<float>(config::VIRUS_ROTATE_RATE) * misc::PER_MS_TO_US;
+        auto& virus = Configuration::getSnapshot().virus;
+
+        spec.minSize = virus.sizeMin;
+        spec.maxSize = virus.sizeMax;
+        spec.maxAge = virus.ageMaturity;
+        spec.healthStart = virus.healthStart;
+        spec.healthIncrements = virus.healthIncrements;
+        spec.healthIncrementTime = virus.healthIncrementTime;
+        spec.gestationMin = virus.gestationMin;
+        spec.gestationMean = virus.gestationMean;
+        spec.gestationStdev = virus.gestationStdev;
+        spec.rotateRate = virus.rotateRate * misc::PER_MS_TO_US;
 
         return spec;
     }
@@ -113,7 +114,7 @@ namespace entities
         auto momentum = math::Vector2f(std::cos(angle), std::sin(angle));
         //
         // Have to scale back the magnitude of the momentum quite a bit
-        auto speed = Configuration::get<float>(config::VIRUS_SPEED);
+        auto speed = Configuration::getSnapshot().virus.speed;
         momentum.x *= speed;
         momentum.y *= speed;
         momentumCmp->set(momentum);
@@ -51,20 +51,14 @@ namespace entities
     // grabbed from the configuration here.
     //
     // --------------------------------------------------------------
-    void Weapon::loadAttributes(std::string key)
+    void Weapon::loadAttributes(config::WeaponName name)
     {
-        using namespace std::string_literals;
-        using namespace config;
+        auto& weapon = Configuration::getSnapshot().weapon(name);
 
-        const config_path WEAPON_DAMAGE = { DOM_ENTITY, key, DOM_DAMAGE };
-        const config_path WEAPON_FIRE_DELAY = { DOM_ENTITY, key, DOM_FIRE_DELAY };
-        const config_path WEAPON_ITEM_LIFETIME = { DOM_ENTITY, key, DOM_LIFETIME };
-        const config_path WEAPON_ITEM_SIZE = { DOM_ENTITY, key, DOM_SIZE };
-
-        m_fireDelay = misc::msTous(Configuration::get<std::chrono::milliseconds>(WEAPON_FIRE_DELAY));
-        m_itemDamage = Configuration::get<std::uint16_t>(WEAPON_DAMAGE);
-        m_itemLifetime = misc::msTous(Configuration::get<std::chrono::milliseconds>(WEAPON_ITEM_LIFETIME));
-        m_itemSize = Configuration::get<float>(WEAPON_ITEM_SIZE);
+        m_fireDelay = weapon.fireDelay;
+        m_itemDamage = weapon.damage;
+        m_itemLifetime = weapon.lifetime;
+        m_itemSize = weapon.size;
     }
 
 } // namespace entities
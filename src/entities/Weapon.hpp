@@ -24,12 +24,13 @@ THE SOFTWARE.
 
 #include "entities/Bullet.hpp"
 #include "entities/Entity.hpp"
+#include "services/ConfigurationSnapshot.hpp"
+#include "services/ContentKey.hpp"
 
 #include <chrono>
 #include <cstdint>
 #include <functional>
 #include <memory>
-#include <string>
 
 namespace entities
 {
@@ -37,10 +38,10 @@ namespace entities
     {
       public:
         Weapon() = default;
-        Weapon(std::string key) :
+        Weapon(config::WeaponName name) :
             m_lastFire(std::chrono::system_clock::now())
         {
-            loadAttributes(key);
+            loadAttributes(name);
             // Subtract the fire delay so it can immediately fire
             m_lastFire -= m_fireDelay;
         }
@@ -57,9 +58,9 @@ namespace entities
         std::chrono::microseconds m_itemLifetime{ 0 }; // Can't think of a better name?
         float m_itemSize{ 0 };
 
-        std::string m_soundKey;
+        content::Key m_soundKey{ content::KEY_AUDIO_BASIC_GUN_FIRE };
 
-        void loadAttributes(std::string key);
+        void loadAttributes(config::WeaponName name);
         virtual void fireImpl([[maybe_unused]] std::function<void(std::shared_ptr<entities::Entity>&)>& emitBullet, [[maybe_unused]] std::function<void(std::shared_ptr<entities::Entity>&)>& emitBomb){};
     };
 } // namespace entities
@@ -33,8 +33,8 @@ THE SOFTWARE.
 namespace entities
 {
 
-    WeaponBomb::WeaponBomb(std::string key) :
-        Weapon(key)
+    WeaponBomb::WeaponBomb(config::WeaponName name) :
+        Weapon(name)
     {
         m_soundKey = content::KEY_AUDIO_BOMB_FIRE;
     }
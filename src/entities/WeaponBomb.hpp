@@ -25,7 +25,6 @@ THE SOFTWARE.
 #include "entities/Weapon.hpp"
 
 #include <memory>
-#include <string>
 
 namespace entities
 {
@@ -36,7 +35,7 @@ namespace entities
     class WeaponBomb : public Weapon
     {
       public:
-        WeaponBomb(std::string key);
+        WeaponBomb(config::WeaponName name);
 
       protected:
         virtual void fireImpl(std::function<void(std::shared_ptr<entities::Entity>&)>& emitBullet, std::function<void(std::shared_ptr<entities::Entity>&)>& emitBomb) override;
@@ -33,8 +33,8 @@ THE SOFTWARE.
 namespace entities
 {
 
-    WeaponGun::WeaponGun(std::string key) :
-        Weapon(key)
+    WeaponGun::WeaponGun(config::WeaponName name) :
+        Weapon(name)
     {
         m_soundKey = content::KEY_AUDIO_BASIC_GUN_FIRE;
     }
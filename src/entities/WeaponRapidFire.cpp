@@ -34,8 +34,8 @@ THE SOFTWARE.
 namespace entities
 {
 
-    WeaponRapidFire::WeaponRapidFire(std::string key) :
-        Weapon(key)
+    WeaponRapidFire::WeaponRapidFire(config::WeaponName name) :
+        Weapon(name)
     {
         m_soundKey = content::KEY_AUDIO_BASIC_GUN_FIRE;
     }
@@ -34,8 +34,8 @@ THE SOFTWARE.
 namespace entities
 {
 
-    WeaponSpreadFire::WeaponSpreadFire(std::string key) :
-        Weapon(key)
+    WeaponSpreadFire::WeaponSpreadFire(config::WeaponName name) :
+        Weapon(name)
     {
         m_soundKey = content::KEY_AUDIO_BASIC_GUN_FIRE;
     }
@@ -25,7 +25,6 @@ THE SOFTWARE.
 #include "entities/Weapon.hpp"
 
 #include <memory>
-#include <string>
 
 namespace entities
 {
@@ -37,7 +36,7 @@ namespace entities
     class WeaponSpreadFire : public Weapon
     {
       public:
-        WeaponSpreadFire(std::string key);
+        WeaponSpreadFire(config::WeaponName name);
 
       protected:
         virtual void fireImpl(std::function<void(std::shared_ptr<entities::Entity>&)>& emitBullet, std::function<void(std::shared_ptr<entities::Entity>&)>& emitBomb) override;
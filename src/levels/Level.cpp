@@ -33,60 +33,75 @@ THE SOFTWARE.
 namespace levels
 {
 
-    Level::Level(const std::string key) :
-        m_key(key)
+    Level::Level(LevelName name) :
+        m_name(name)
     {
-        using namespace std::string_literals;
-        using namespace config;
-
-        const config_path MESSAGE_READY = { DOM_LEVELS, key, DOM_CONTENT, DOM_MESSAGES, DOM_READY };
-        const config_path MESSAGE_SUCCESS = { DOM_LEVELS, key, DOM_CONTENT, DOM_MESSAGES, DOM_SUCCESS };
-        const config_path MESSAGE_FAILURE = { DOM_LEVELS, key, DOM_CONTENT, DOM_MESSAGES, DOM_FAILURE };
-        const config_path INITIAL_VIRUS_COUNT = { DOM_LEVELS, key, DOM_SETTINGS, DOM_INITIAL_VIRUS_COUNT };
-        const config_path MAX_VIRUS_COUNT = { DOM_LEVELS, key, DOM_SETTINGS, DOM_MAX_VIRUS_COUNT };
-        const config_path NANO_BOT_COUNT = { DOM_LEVELS, key, DOM_SETTINGS, DOM_NANO_BOT_COUNT };
-        const config_path MIN_POWERUP_TIME = { DOM_LEVELS, key, DOM_SETTINGS, "min-powerup-time"s };
-        const config_path BOMB_POWERUP_TIME = { DOM_LEVELS, key, DOM_SETTINGS, "bomb-powerup-time"s };
-        const config_path RAPID_FIRE_POWERUP_TIME = { DOM_LEVELS, key, DOM_SETTINGS, "rapid-fire-powerup-time"s };
-        const config_path SPREAD_FIRE_POWERUP_TIME = { DOM_LEVELS, key, DOM_SETTINGS, "spread-fire-powerup-time"s };
-
-        m_messageReady = Configuration::get<std::string>(MESSAGE_READY);
-        m_messageSuccess = Configuration::get<std::string>(MESSAGE_SUCCESS);
-        m_messageFailure = Configuration::get<std::string>(MESSAGE_FAILURE);
-
-        m_backgroundImagePath = { DOM_LEVELS, key, DOM_CONTENT, DOM_IMAGE, DOM_BACKGROUND };
-        m_backgroundImageKey = "image/" + key + "-background";
-
-        m_backgroundMusicPath = { DOM_LEVELS, key, DOM_CONTENT, DOM_MUSIC, DOM_BACKGROUND };
-        m_backgroundMusicKey = "music/" + key + "-background";
-
-        m_initialVirusCount = Configuration::get<std::uint8_t>(INITIAL_VIRUS_COUNT);
-        m_maxVirusCount = Configuration::get<std::uint8_t>(MAX_VIRUS_COUNT);
-        m_nanoBotCount = Configuration::get<std::uint8_t>(NANO_BOT_COUNT);
+        auto& settings = Configuration::getSnapshot().level(name);
+
+        m_messageReady = settings.messageReady;
+        m_messageSuccess = settings.messageSuccess;
+        m_messageFailure = settings.messageFailure;
+
+        m_backgroundImageKey = backgroundImageKey(config::name(name));
+        m_backgroundMusicKey = backgroundMusicKey(config::name(name));
+
+        m_initialVirusCount = settings.initialVirusCount;
+        m_maxVirusCount = settings.maxVirusCount;
+        m_nanoBotCount = settings.nanoBotCount;
+    }
+
+    // --------------------------------------------------------------
+    //
+    // Get the content necessary for the level loaded here.  The handle
+    // completes once all of it is available.
+    //
+    // --------------------------------------------------------------
+    Content::Handle Level::loadContent()
+    {
+        m_content.add(m_backgroundImageKey);
+        m_content.add(m_backgroundMusicKey);
+
+        return loadContent(m_name, Content::Priority::Level);
     }
 
     // --------------------------------------------------------------
     //
-    // Get the content necessary for the level loaded here.
+    // Starts loading the content for a level that might be played soon,
+    // without creating the level.  It only loads when nothing more urgent
+    // is waiting, and if the level is then chosen while it is still
+    // loading, it is moved up to level priority rather than loaded twice.
+    // Nothing references prefetched content, so it is the first to be
+    // evicted if the level isn't chosen.
     //
     // --------------------------------------------------------------
-    void Level::loadContent()
+    Content::Handle Level::prefetchContent(LevelName name)
+    {
+        return loadContent(name, Content::Priority::Prefetch);
+    }
+
+    Content::Handle Level::loadContent(LevelName name, Content::Priority priority)
     {
-        if (!Content::has<sf::Texture>(m_backgroundImageKey))
+        auto& settings = Configuration::getSnapshot().level(name);
+        std::string key = config::name(name);
+
+        std::vector<Content::Handle> content;
+        if (auto imageKey = backgroundImageKey(key); !Content::has<sf::Texture>(imageKey))
         {
-            Content::load<sf::Texture>(
-                m_backgroundImageKey,
-                Configuration::get<std::string>(m_backgroundImagePath),
-                nullptr, nullptr);
+            content.push_back(Content::load<sf::Texture>(
+                imageKey,
+                settings.backgroundImage,
+                nullptr, nullptr, priority));
         }
 
-        if (!Content::has<sf::Music>(m_backgroundMusicKey))
+        if (auto musicKey = backgroundMusicKey(key); !Content::has<sf::Music>(musicKey))
         {
-            Content::load<sf::Music>(
-                m_backgroundMusicKey,
-                Configuration::get<std::string>(m_backgroundMusicPath),
-                nullptr, nullptr);
+            content.push_back(Content::load<sf::Music>(
+                musicKey,
+                settings.backgroundMusic,
+                nullptr, nullptr, priority));
         }
+
+        return Content::whenAll(content);
     }
 
 } // namespace levels
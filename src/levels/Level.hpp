@@ -26,7 +26,9 @@ THE SOFTWARE.
 #include "entities/Powerup.hpp"
 #include "entities/Virus.hpp"
 #include "misc/math.hpp"
+#include "levels/LevelName.hpp"
 #include "services/ConfigurationPath.hpp"
+#include "services/Content.hpp"
 
 #include <algorithm>
 #include <chrono>
@@ -40,13 +42,14 @@ namespace levels
     class Level
     {
       public:
-        Level(const std::string key);
+        Level(LevelName name);
         virtual ~Level(){}; // Needed for std::unique_ptr to be happy
 
-        virtual void loadContent();
+        virtual Content::Handle loadContent();
+        static Content::Handle prefetchContent(LevelName name);
         virtual std::vector<std::shared_ptr<entities::Virus>> initializeViruses() = 0;
 
-        auto getKey() { return m_key; }
+        auto getName() { return m_name; }
         auto getBackgroundImageKey() { return m_backgroundImageKey; }
         auto getBackgroundMusicKey() { return m_backgroundMusicKey; }
         auto getBackgroundSize() { return m_backgroundSize; }
@@ -63,10 +66,8 @@ namespace levels
         virtual math::Point2f computePowerupPosition() = 0;
 
       protected:
-        config::config_path m_backgroundImagePath;
-        std::string m_backgroundImageKey;
-        config::config_path m_backgroundMusicPath;
-        std::string m_backgroundMusicKey;
+        content::Key m_backgroundImageKey;
+        content::Key m_backgroundMusicKey;
         std::uint8_t m_initialVirusCount;
         std::uint8_t m_maxVirusCount;
         std::uint8_t m_nanoBotCount;
@@ -74,9 +75,14 @@ namespace levels
         math::Dimension2f m_backgroundSize{ 0.0f, 0.0f };
 
       private:
-        std::string m_key;
+        LevelName m_name;
+        Content::Group m_content; // Keeps the level content resident for as long as the level exists
         std::string m_messageReady;
         std::string m_messageSuccess;
         std::string m_messageFailure;
+
+        static content::Key backgroundImageKey(const std::string& key) { return content::Key("image/" + key + "-background"); }
+        static content::Key backgroundMusicKey(const std::string& key) { return content::Key("music/" + key + "-background"); }
+        static Content::Handle loadContent(LevelName name, Content::Priority priority);
     };
 } // namespace levels
\ No newline at end of file
@@ -34,8 +34,8 @@ THE SOFTWARE.
 
 namespace levels
 {
-    PetriDish::PetriDish(std::string key, bool training) :
-        Level(key),
+    PetriDish::PetriDish(LevelName name, bool training) :
+        Level(name),
         m_training(training),
         m_generator(m_rd()),
         m_distUniform(0.0f, 1.0f),
@@ -71,7 +71,7 @@ namespace levels
             else
             {
                 // Choose an age
-                auto maxAge = misc::msTous(std::chrono::milliseconds(Configuration::get<std::uint32_t>(config::VIRUS_AGE_MATURITY)));
+                auto maxAge = Configuration::getSnapshot().virus.ageMaturity;
                 auto age = std::chrono::duration_cast<std::chrono::microseconds>(m_distUniform(m_generator) * maxAge);
                 virus = std::make_shared<entities::Virus>(age);
             }
@@ -105,7 +105,7 @@ namespace levels
     // --------------------------------------------------------------
     std::optional<math::Point2f> PetriDish::findSafeStart(std::chrono::microseconds howLongWaiting, const std::unordered_map<entities::Entity::IdType, std::shared_ptr<entities::Entity>>& viruses)
     {
-        const float shipSize = Configuration::get<float>(config::PLAYER_SIZE);
+        const float shipSize = Configuration::getSnapshot().player.size;
 
         auto getMinDistance = [](math::Point2f position, const std::unordered_map<entities::Entity::IdType, std::shared_ptr<entities::Entity>>& viruses)
         {
@@ -166,7 +166,7 @@ namespace levels
 
     bool PetriDish::collidesWithBorder(entities::Entity& entity)
     {
-        static auto const ARENA_RADIUS = Configuration::getGraphics().getViewCoordinates().height / 2.0f - 4.0f;
+        auto arenaRadius = Configuration::getGraphics().getViewCoordinates().height / 2.0f - 4.0f;
 
         auto position = entity.getComponent<components::Position>();
         auto radius = entity.getComponent<components::Size>()->getOuterRadius();
@@ -175,7 +175,7 @@ namespace levels
         // Add in half of its outer radius to account for the size
         distance += (radius / 2.0f);
 
-        return distance > ARENA_RADIUS;
+        return distance > arenaRadius;
     }
 
     void PetriDish::bounceOffBorder(entities::Entity& entity)
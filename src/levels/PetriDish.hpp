@@ -35,7 +35,7 @@ namespace levels
     class PetriDish : public Level
     {
       public:
-        PetriDish(std::string key, bool training);
+        PetriDish(LevelName name, bool training);
 
         virtual std::vector<std::shared_ptr<entities::Virus>> initializeViruses() override;
         virtual std::optional<math::Point2f> findSafeStart(std::chrono::microseconds howLongWaiting, const std::unordered_map<entities::Entity::IdType, std::shared_ptr<entities::Entity>>& viruses) override;
@@ -20,6 +20,7 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 THE SOFTWARE.
 */
 
+#include "renderers/RenderThread.hpp"
 #include "services/Configuration.hpp"
 #include "services/ConfigurationPath.hpp"
 #include "services/Content.hpp"
@@ -27,6 +28,7 @@ THE SOFTWARE.
 #include "services/KeyboardInput.hpp"
 #include "services/MouseInput.hpp"
 #include "services/SoundPlayer.hpp"
+#include "services/TextureAtlas.hpp"
 #include "views/About.hpp"
 #include "views/Credits.hpp"
 #include "views/Gameplay.hpp"
@@ -39,7 +41,6 @@ THE SOFTWARE.
 #include <SFML/Graphics.hpp>
 #include <SFML/Window.hpp>
 #include <algorithm>
-#include <atomic>
 #include <chrono>
 #include <fstream>
 #include <iostream>
@@ -47,6 +48,7 @@ THE SOFTWARE.
 #include <sstream>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 //
 // This should not be in the Configuration.hpp header because client/server
@@ -181,90 +183,69 @@ void prepareView(std::shared_ptr<sf::RenderWindow> window)
     window->setView(view);
 }
 
-bool loadMenuContent()
+bool loadMenuContent(Content::Group& group)
 {
-    std::atomic_bool success{ true };
-    std::condition_variable eventContent;
-    std::mutex mutexContent;
-
-    auto onComplete = [&]([[maybe_unused]] std::string key)
-    {
-        eventContent.notify_one();
-    };
-    auto onError = [&]([[maybe_unused]] std::string filename)
-    {
-        success = false;
-        eventContent.notify_one();
-    };
+    std::vector<Content::Handle> menuContent;
 
     //
     // Get the fonts loaded
-    Content::load<sf::Font>(content::KEY_FONT_TITLE, Configuration::get<std::string>(config::FONT_TITLE_FILENAME), nullptr, onError);
-    Content::load<sf::Font>(content::KEY_FONT_MENU, Configuration::get<std::string>(config::FONT_MENU_FILENAME), nullptr, onError);
-    Content::load<sf::Font>(content::KEY_FONT_CREDITS, Configuration::get<std::string>(config::FONT_CREDITS_FILENAME), nullptr, onError);
-    Content::load<sf::Font>(content::KEY_FONT_GAME_STATUS, Configuration::get<std::string>(config::FONT_GAME_STATUS_FILENAME), nullptr, onError);
-    Content::load<sf::Font>(content::KEY_FONT_SETTINGS, Configuration::get<std::string>(config::FONT_SETTINGS_FILENAME), nullptr, onError);
-    Content::load<sf::Font>(content::KEY_FONT_LEVEL_SELECT, Configuration::get<std::string>(config::FONT_LEVEL_SELECT_FILENAME), nullptr, onError);
-    Content::load<sf::Font>(content::KEY_FONT_GAMEPLAY, Configuration::get<std::string>(config::FONT_GAMEPLAY_FILENAME), nullptr, onError);
+    menuContent.push_back(group.load<sf::Font>(content::KEY_FONT_TITLE, Configuration::get<std::string>(config::FONT_TITLE_FILENAME), Content::Priority::Menu));
+    menuContent.push_back(group.load<sf::Font>(content::KEY_FONT_MENU, Configuration::get<std::string>(config::FONT_MENU_FILENAME), Content::Priority::Menu));
+    menuContent.push_back(group.load<sf::Font>(content::KEY_FONT_CREDITS, Configuration::get<std::string>(config::FONT_CREDITS_FILENAME), Content::Priority::Menu));
+    menuContent.push_back(group.load<sf::Font>(content::KEY_FONT_GAME_STATUS, Configuration::get<std::string>(config::FONT_GAME_STATUS_FILENAME), Content::Priority::Menu));
+    menuContent.push_back(group.load<sf::Font>(content::KEY_FONT_SETTINGS, Configuration::get<std::string>(config::FONT_SETTINGS_FILENAME), Content::Priority::Menu));
+    menuContent.push_back(group.load<sf::Font>(content::KEY_FONT_LEVEL_SELECT, Configuration::get<std::string>(config::FONT_LEVEL_SELECT_FILENAME), Content::Priority::Menu));
+    menuContent.push_back(group.load<sf::Font>(content::KEY_FONT_GAMEPLAY, Configuration::get<std::string>(config::FONT_GAMEPLAY_FILENAME), Content::Priority::Menu));
 
     //
     // Get the menu audio activate and accept clips loaded
-    Content::load<sf::SoundBuffer>(content::KEY_MENU_ACTIVATE, Configuration::get<std::string>(config::AUDIO_MENU_ACTIVATE), nullptr, onError);
-    Content::load<sf::SoundBuffer>(content::KEY_MENU_ACCEPT, Configuration::get<std::string>(config::AUDIO_MENU_ACCEPT), nullptr, onError);
+    menuContent.push_back(group.load<sf::SoundBuffer>(content::KEY_MENU_ACTIVATE, Configuration::get<std::string>(config::AUDIO_MENU_ACTIVATE), Content::Priority::Menu));
+    menuContent.push_back(group.load<sf::SoundBuffer>(content::KEY_MENU_ACCEPT, Configuration::get<std::string>(config::AUDIO_MENU_ACCEPT), Content::Priority::Menu));
 
     //
     // Get the background image loaded
-    Content::load<sf::Texture>(content::KEY_IMAGE_MENU_BACKGROUND, Configuration::get<std::string>(config::IMAGE_MENU_BACKGROUND), onComplete, onError);
+    menuContent.push_back(group.load<sf::Texture>(content::KEY_IMAGE_MENU_BACKGROUND, Configuration::get<std::string>(config::IMAGE_MENU_BACKGROUND), Content::Priority::Menu));
 
     //
-    // Use an efficient wait for the initial content to finish loading
-    std::unique_lock<std::mutex> lock(mutexContent);
-    eventContent.wait(lock);
-    return success;
+    // Everything loads in parallel, so wait on the group as a whole, this
+    // returns once all of it has completed, successfully or not.
+    return Content::whenAll(menuContent).get();
 }
 
 // --------------------------------------------------------------
 //
-// This is my hack to reset the application window whenever the user
-// changes the resolution or full/window options.
+// Whenever the user changes the resolution or full/window options, the
+// window has to be created again.  Only the window and the view transform
+// are recreated, everything that depends upon them is told through the
+// graphics changed handlers, so all of the loaded content and the state
+// of the views is kept.
 //
-// The way I am having to completely reset the configuration completely is pretty bad,
-// but I have struggled with SFML and getting the UI to render correctly based on
-// different resolutions.  Completely resetting the configuration was the path of least
-// resistance to accomplish the task at hand.  In a future program, I'll look into redoing
-// how I use the SFML to get things rendered and hopefully also fix this at that time...or
-// more likely, not use the SFML, just build from the ground up myself.
+// The view coordinates are put back to where they start out before the
+// view is prepared, because preparing it scales them by the aspect ratio.
 //
 // --------------------------------------------------------------
-std::shared_ptr<sf::RenderWindow> resetWindow(std::unordered_map<views::ViewState, std::shared_ptr<views::View>>& views, std::shared_ptr<views::View>& view, std::shared_ptr<sf::RenderWindow> window)
+std::shared_ptr<sf::RenderWindow> reconfigureWindow(std::shared_ptr<views::View>& view, std::shared_ptr<sf::RenderWindow> window, std::unique_ptr<renderers::RenderThread>& renderThread)
 {
     Configuration::getGraphics().setRestart(false);
     saveConfiguration();
-    Configuration::instance()->reset();
-    readConfiguration();
 
     //
-    // Shutdown the current window and view
+    // Shutdown the current window and view, the render thread has to let go of the window first
     view->stop();
-    window->setActive(false);
+    renderThread->stop();
     window->close();
 
     //
-    // Create and activate the window for rendering on the main thread
+    // Create the window and hand it over to a new render thread
     auto newWindow = prepareWindow();
+    Configuration::getGraphics().reset();
     prepareView(newWindow);
-    newWindow->setActive(true);
+    renderThread = std::make_unique<renderers::RenderThread>(newWindow);
+    renderThread->start();
 
     //
-    // Construct the different views the game may show, then get
-    // the initial view set and ready to run.
-    views.clear();
-    views[views::ViewState::MainMenu] = std::make_shared<views::MainMenu>();
-    views[views::ViewState::LevelSelect] = std::make_shared<views::LevelSelect>();
-    views[views::ViewState::GamePlay] = std::make_shared<views::Gameplay>();
-    views[views::ViewState::Credits] = std::make_shared<views::Credits>();
-    views[views::ViewState::About] = std::make_shared<views::About>();
-    views[views::ViewState::Settings] = std::make_shared<views::Settings>();
+    // Let the views know, they redo their layout the next time they are started
+    Configuration::getGraphics().signalChanged();
 
     return newWindow;
 }
@@ -284,9 +265,11 @@ int main()
     SoundPlayer::instance().initialize();
 
     //
-    // The Content singleton needs to be specifically initialized
-    Content::instance().initialize();
-    if (!loadMenuContent())
+    // The Content singleton needs to be specifically initialized.  The budget is in megabytes,
+    // widened before converting to bytes so large budgets don't overflow.
+    Content::instance().initialize(static_cast<std::size_t>(Configuration::get<std::uint32_t>(config::CONTENT_MEMORY_BUDGET)) * 1024 * 1024);
+    Content::Group menuGroup;
+    if (!loadMenuContent(menuGroup))
     {
         Content::instance().terminate();
         exit(0);
@@ -298,10 +281,11 @@ int main()
     MouseInput::instance().initialize();
 
     //
-    // Create and activate the window for rendering on the main thread
+    // Create the window, rendering into it takes place on the render thread
     auto window = prepareWindow();
     prepareView(window);
-    window->setActive(true);
+    auto renderThread = std::make_unique<renderers::RenderThread>(window);
+    renderThread->start();
 
     //
     // Construct the different views the game may show, then get
@@ -399,14 +383,13 @@ int main()
 
         // Step 2: Update
         auto nextViewState = view->update(elapsedTime, currentTime);
+        SoundPlayer::instance().update(elapsedTime);
 
         // Step 3: Render
-        view->render(*window, elapsedTime);
-
-        //
-        // BUT, we still wait until here to display the window...this is what actually
-        // causes the rendering to occur.
-        window->display();
+        // The view records what it draws into a frame, which is handed off to the
+        // render thread to draw and display while the next update is taking place.
+        view->render(renderThread->beginFrame(), elapsedTime);
+        renderThread->endFrame();
 
         //
         // Constantly check to see if the view should change.
@@ -436,9 +419,7 @@ int main()
         // Constantly check to see if the window should be restarted, due to a graphics option having changed.
         if (Configuration::getGraphics().restart())
         {
-            window = resetWindow(views, view, window);
-
-            view = views[viewState];
+            window = reconfigureWindow(view, window, renderThread);
             if (!view->start())
             {
                 std::cout << "Failed to restart in the newly selection screen/resolution settings, terminating..." << std::endl;
@@ -448,8 +429,10 @@ int main()
     }
 
     // Gracefully shut things down
+    renderThread->stop();
     saveConfiguration();
     SoundPlayer::instance().terminate();
+    TextureAtlas::instance().clear();
     Content::instance().terminate();
 
     // Do this after shutting down the Content singleton so that all textures
@@ -22,30 +22,96 @@ THE SOFTWARE.
 
 #pragma once
 
-#include <deque>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <mutex>
 #include <optional>
+#include <utility>
 
 // ------------------------------------------------------------------
 //
-// @details This is a fairly simple concurrent queue that allows thread
-// safe access.
+// @details A bounded, lock-free queue that any number of threads can
+// enqueue to and dequeue from.  Each cell of the ring carries a
+// sequence number that says whether it is ready to be written or read
+// for the current lap around the ring, so a thread claims a cell with
+// a single compare-exchange on the enqueue or dequeue position, and
+// only ever waits on another thread that is part way through writing
+// or reading that same cell.  When the queue is full, enqueue fails
+// rather than blocking or growing.
+//
+// Items are moved in and out, never copied.  The capacity must be a
+// power of two, so the positions can simply be masked.
+//
+// A consumer that has nothing to do can wait in waitDequeue.  It only
+// takes the lock once the queue is empty, and producers only take the
+// lock to wake it when someone is actually waiting.
 //
 // ------------------------------------------------------------------
-template <typename T>
+template <typename T, std::size_t Capacity = 1024>
 class ConcurrentQueue
 {
+    static_assert(Capacity > 1 && (Capacity & (Capacity - 1)) == 0, "ConcurrentQueue capacity must be a power of two");
+
   public:
+    ConcurrentQueue() :
+        m_cells(std::make_unique<Cell[]>(Capacity))
+    {
+        for (std::size_t position = 0; position < Capacity; position++)
+        {
+            m_cells[position].sequence.store(position, std::memory_order_relaxed);
+        }
+    }
+
+    ConcurrentQueue(const ConcurrentQueue&) = delete;
+    ConcurrentQueue& operator=(const ConcurrentQueue&) = delete;
+
     // ------------------------------------------------------------------
     //
-    // Enqueues a new item onto the queue
+    // Enqueues a new item onto the queue.  Returns false if the queue is
+    // full, in which case the item is left as it was.
     //
     // ------------------------------------------------------------------
-    void enqueue(const T& item)
+    bool enqueue(T&& item)
     {
-        std::lock_guard<std::mutex> lock(m_mutex);
+        auto position = m_enqueuePosition.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+        while (true)
+        {
+            cell = &m_cells[position & MASK];
+            auto sequence = cell->sequence.load(std::memory_order_acquire);
+            auto difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+            if (difference == 0)
+            {
+                if (m_enqueuePosition.compare_exchange_weak(position, position + 1))
+                {
+                    break;
+                }
+            }
+            else if (difference < 0)
+            {
+                return false;
+            }
+            else
+            {
+                position = m_enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+        cell->item.emplace(std::move(item));
+        cell->sequence.store(position + 1, std::memory_order_release);
 
-        m_queue.push_back(item);
+        //
+        // Claiming the position and then checking for waiters (a waiter counts itself and
+        // then checks the size) ensures one or the other sees the item.
+        if (m_waiting.load() > 0)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_event.notify_one();
+        }
+
+        return true;
     }
 
     // ------------------------------------------------------------------
@@ -57,21 +123,121 @@ class ConcurrentQueue
     // ------------------------------------------------------------------
     std::optional<T> dequeue()
     {
-        std::lock_guard<std::mutex> lock(m_mutex);
+        auto position = m_dequeuePosition.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+        while (true)
+        {
+            cell = &m_cells[position & MASK];
+            auto sequence = cell->sequence.load(std::memory_order_acquire);
+            auto difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position + 1);
+            if (difference == 0)
+            {
+                if (m_dequeuePosition.compare_exchange_weak(position, position + 1))
+                {
+                    break;
+                }
+            }
+            else if (difference < 0)
+            {
+                return std::nullopt;
+            }
+            else
+            {
+                position = m_dequeuePosition.load(std::memory_order_relaxed);
+            }
+        }
+        std::optional<T> item(std::move(cell->item));
+        cell->item.reset();
+        cell->sequence.store(position + Capacity, std::memory_order_release);
+
+        return item;
+    }
 
-        if (!m_queue.empty())
+    // ------------------------------------------------------------------
+    //
+    // Dequeues up to 'count' items, writing them to 'out', returns how
+    // many were dequeued.
+    //
+    // ------------------------------------------------------------------
+    template <typename OutputIterator>
+    std::size_t dequeueBulk(OutputIterator out, std::size_t count)
+    {
+        std::size_t howMany = 0;
+        for (; howMany < count; howMany++)
         {
-            auto item = m_queue.front();
-            m_queue.pop_front();
-            return item;
+            auto item = dequeue();
+            if (!item.has_value())
+            {
+                break;
+            }
+            *out++ = std::move(*item);
         }
 
-        return std::nullopt;
+        return howMany;
     }
 
-    std::size_t size() { return m_queue.size(); }
+    // ------------------------------------------------------------------
+    //
+    // Dequeues an item, waiting for one if the queue is empty.  Returns
+    // std::nullopt only once 'done' is set; whoever sets it has to call
+    // wakeAll afterwards.
+    //
+    // ------------------------------------------------------------------
+    std::optional<T> waitDequeue(const std::atomic_bool& done)
+    {
+        while (true)
+        {
+            if (auto item = dequeue(); item.has_value())
+            {
+                return item;
+            }
+            if (done)
+            {
+                return std::nullopt;
+            }
+
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_waiting++;
+            m_event.wait(lock, [this, &done]()
+                         { return done || size() > 0; });
+            m_waiting--;
+        }
+    }
+
+    void wakeAll()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_event.notify_all();
+    }
+
+    // ------------------------------------------------------------------
+    //
+    // Items that have been claimed by enqueue and not yet by dequeue.
+    // The dequeue position is read first; it never passes the enqueue
+    // position, so the difference can't go negative.
+    //
+    // ------------------------------------------------------------------
+    std::size_t size() const
+    {
+        auto dequeued = m_dequeuePosition.load();
+        return m_enqueuePosition.load() - dequeued;
+    }
 
   private:
-    std::deque<T> m_queue;
+    static constexpr std::size_t MASK = Capacity - 1;
+
+    struct Cell
+    {
+        std::atomic<std::size_t> sequence{ 0 };
+        std::optional<T> item;
+    };
+
+    std::unique_ptr<Cell[]> m_cells;
+    // On separate cache lines, so producers and consumers don't contend over them
+    alignas(64) std::atomic<std::size_t> m_enqueuePosition{ 0 };
+    alignas(64) std::atomic<std::size_t> m_dequeuePosition{ 0 };
+
+    std::atomic<std::uint32_t> m_waiting{ 0 };
     std::mutex m_mutex;
+    std::condition_variable m_event;
 };
@@ -0,0 +1,164 @@
+/*
+Copyright (c) 2021 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// ------------------------------------------------------------------
+//
+// @details A read-copy-update table of shared pointers, indexed by a
+// small integer id.  Readers atomically load the current snapshot and
+// index into it without ever taking a lock or waiting on a writer.  A
+// writer copies the current snapshot, updates the copy and atomically
+// publishes it as the new current snapshot.
+//
+// Readers may still be looking at an older snapshot after a publish,
+// so old snapshots are retired rather than freed right away.  Readers
+// count themselves in and out, and retired snapshots are freed by the
+// next writer that finds no reader in the table.  Any reader arriving
+// after that can only see the current snapshot.  Freeing the retired
+// snapshots is what lets the memory of erased entries be reclaimed.
+//
+// ------------------------------------------------------------------
+template <typename T>
+class RcuTable
+{
+  public:
+    using Snapshot = std::vector<std::shared_ptr<T>>;
+
+    RcuTable()
+    {
+        m_snapshots.push_back(std::make_unique<Snapshot>());
+        m_current = m_snapshots.back().get();
+    }
+
+    // ------------------------------------------------------------------
+    //
+    // Reader side: wait-free.  nullptr is returned when there is no
+    // entry for the id.
+    //
+    // ------------------------------------------------------------------
+    std::shared_ptr<T> find(std::size_t id) const
+    {
+        Reader reader(m_readers);
+        auto snapshot = m_current.load();
+        return id < snapshot->size() ? (*snapshot)[id] : nullptr;
+    }
+
+    bool contains(std::size_t id) const
+    {
+        Reader reader(m_readers);
+        auto snapshot = m_current.load();
+        return id < snapshot->size() && (*snapshot)[id] != nullptr;
+    }
+
+    // ------------------------------------------------------------------
+    //
+    // Writer side: writers are serialized with each other, but never
+    // block a reader.
+    //
+    // ------------------------------------------------------------------
+    void insert(std::size_t id, std::shared_ptr<T> value)
+    {
+        std::lock_guard<std::mutex> lock(m_mutexWriters);
+        auto next = std::make_unique<Snapshot>(*m_current.load(std::memory_order_relaxed));
+        if (id >= next->size())
+        {
+            next->resize(id + 1);
+        }
+        (*next)[id] = std::move(value);
+        publish(std::move(next));
+    }
+
+    // The entry goes away once no reader can still be looking at it
+    void erase(std::size_t id)
+    {
+        std::lock_guard<std::mutex> lock(m_mutexWriters);
+        if (id >= m_current.load(std::memory_order_relaxed)->size())
+        {
+            return;
+        }
+        auto next = std::make_unique<Snapshot>(*m_current.load(std::memory_order_relaxed));
+        (*next)[id] = nullptr;
+        publish(std::move(next));
+    }
+
+    // ------------------------------------------------------------------
+    //
+    // Frees every snapshot, only call this once no other thread can
+    // still be reading from the table.
+    //
+    // ------------------------------------------------------------------
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(m_mutexWriters);
+        m_snapshots.clear();
+        m_snapshots.push_back(std::make_unique<Snapshot>());
+        m_current.store(m_snapshots.back().get(), std::memory_order_release);
+    }
+
+  private:
+    class Reader
+    {
+      public:
+        Reader(std::atomic_uint32_t& readers) :
+            m_readers(readers)
+        {
+            m_readers++;
+        }
+        ~Reader()
+        {
+            m_readers--;
+        }
+
+      private:
+        std::atomic_uint32_t& m_readers;
+    };
+
+    std::atomic<const Snapshot*> m_current;
+    mutable std::atomic_uint32_t m_readers{ 0 };
+    std::mutex m_mutexWriters;
+    std::vector<std::unique_ptr<const Snapshot>> m_snapshots; // The current one is always last
+
+    // ------------------------------------------------------------------
+    //
+    // Only called by a writer, holding the writers lock.  The publish
+    // and the reader count use sequentially consistent operations, so a
+    // reader not yet counted when the count is checked is guaranteed to
+    // load the snapshot just published.
+    //
+    // ------------------------------------------------------------------
+    void publish(std::unique_ptr<const Snapshot> next)
+    {
+        m_current.store(next.get());
+        m_snapshots.push_back(std::move(next));
+        if (m_readers == 0)
+        {
+            m_snapshots.erase(m_snapshots.begin(), m_snapshots.end() - 1);
+        }
+    }
+};
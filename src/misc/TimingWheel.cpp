@@ -0,0 +1,193 @@
+/*
+Copyright (c) 2021 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "TimingWheel.hpp"
+
+#include <algorithm>
+
+// ------------------------------------------------------------------
+//
+// Schedules the callback to fire once the delay has passed, relative
+// to the current simulation time.  When called from inside a firing
+// callback, the delay is relative to the tick being fired, so repeating
+// events don't drift by the frame time.
+//
+// ------------------------------------------------------------------
+TimingWheel::TimerId TimingWheel::schedule(std::chrono::microseconds delay, Callback callback)
+{
+    std::uint32_t index = 0;
+    if (!m_free.empty())
+    {
+        index = m_free.back();
+        m_free.pop_back();
+    }
+    else
+    {
+        index = static_cast<std::uint32_t>(m_timers.size());
+        m_timers.emplace_back();
+    }
+
+    auto& timer = m_timers[index];
+    auto due = m_base + std::max(delay, std::chrono::microseconds(0));
+    // Round up so an event never fires before its time
+    timer.expires = std::max(static_cast<std::uint64_t>((due.count() + TICK.count() - 1) / TICK.count()), m_tick);
+    timer.callback = std::move(callback);
+
+    insert({ index, timer.generation }, timer.expires);
+
+    return (static_cast<TimerId>(timer.generation) << 32) | index;
+}
+
+// ------------------------------------------------------------------
+//
+// The record is released right away, the slot entry that refers to it
+// is skipped whenever its slot is next visited.  Cancelling an event
+// that already fired (or was already cancelled) is harmless.
+//
+// ------------------------------------------------------------------
+void TimingWheel::cancel(TimerId id)
+{
+    auto index = static_cast<std::uint32_t>(id & 0xffffffff);
+    auto generation = static_cast<std::uint32_t>(id >> 32);
+    if (index < m_timers.size() && m_timers[index].generation == generation)
+    {
+        release(index);
+    }
+}
+
+// ------------------------------------------------------------------
+//
+// Moves simulation time forward, firing every event that comes due
+// along the way, in tick order.
+//
+// ------------------------------------------------------------------
+void TimingWheel::advance(std::chrono::microseconds elapsedTime)
+{
+    m_now += elapsedTime;
+    auto target = static_cast<std::uint64_t>(m_now / TICK);
+
+    while (m_tick <= target)
+    {
+        auto tick = m_tick;
+        //
+        // Each time a level wraps around, bring down the next slot from
+        // the level above, which may in turn need the one above it.
+        for (std::uint8_t level = 1; level < LEVELS && (tick & ((std::uint64_t{ 1 } << (SLOT_BITS * level)) - 1)) == 0; level++)
+        {
+            cascade(level, (tick >> (SLOT_BITS * level)) & SLOT_MASK);
+        }
+
+        //
+        // Anything scheduled from a callback lands on a later tick, so
+        // it is safe to swap the slot out before firing its events.
+        m_firing.swap(m_wheel[0][tick & SLOT_MASK]);
+        m_tick = tick + 1;
+        m_base = tick * TICK;
+        for (auto&& entry : m_firing)
+        {
+            if (isLive(entry))
+            {
+                auto callback = std::move(m_timers[entry.index].callback);
+                release(entry.index);
+                callback();
+            }
+        }
+        m_firing.clear();
+    }
+
+    m_base = m_now;
+}
+
+// ------------------------------------------------------------------
+//
+// Drops every pending event, without firing them, and restarts
+// simulation time at zero.
+//
+// ------------------------------------------------------------------
+void TimingWheel::clear()
+{
+    for (auto&& level : m_wheel)
+    {
+        for (auto&& slot : level)
+        {
+            slot.clear();
+        }
+    }
+    m_timers.clear();
+    m_free.clear();
+    m_now = std::chrono::microseconds(0);
+    m_base = std::chrono::microseconds(0);
+    m_tick = 1;
+}
+
+// ------------------------------------------------------------------
+//
+// Places the entry on the lowest level whose span reaches its expiry.
+//
+// ------------------------------------------------------------------
+void TimingWheel::insert(Entry entry, std::uint64_t expires)
+{
+    auto delta = expires - m_tick;
+    if (delta > MAX_DELTA)
+    {
+        // Park it as far out as the wheel reaches, it gets re-inserted from there
+        expires = m_tick + MAX_DELTA;
+        delta = MAX_DELTA;
+    }
+
+    std::uint8_t level = 0;
+    while (level < LEVELS - 1 && delta >= (std::uint64_t{ 1 } << (SLOT_BITS * (level + 1))))
+    {
+        level++;
+    }
+    m_wheel[level][(expires >> (SLOT_BITS * level)) & SLOT_MASK].push_back(entry);
+}
+
+// ------------------------------------------------------------------
+//
+// Re-inserts the live entries from a slot, relative to the tick being
+// processed, which moves them down at least one level.
+//
+// ------------------------------------------------------------------
+void TimingWheel::cascade(std::uint8_t level, std::uint64_t slot)
+{
+    m_firing.swap(m_wheel[level][slot]);
+    for (auto&& entry : m_firing)
+    {
+        if (isLive(entry))
+        {
+            insert(entry, m_timers[entry.index].expires);
+        }
+    }
+    m_firing.clear();
+}
+
+void TimingWheel::release(std::uint32_t index)
+{
+    auto& timer = m_timers[index];
+    timer.callback = nullptr;
+    if (++timer.generation == 0)
+    {
+        timer.generation = 1; // Keeps ids from ever matching INVALID_TIMER
+    }
+    m_free.push_back(index);
+}
@@ -0,0 +1,103 @@
+/*
+Copyright (c) 2021 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+// ------------------------------------------------------------------
+//
+// @details A hierarchical timing wheel for events keyed on simulation
+// time.  Callers schedule a callback to fire after some delay and get
+// back an id that can be used to cancel it.  Time only moves forward
+// when advance is called, so the per-frame cost is proportional to
+// the number of events that fire, not the number that are pending.
+//
+// Time is quantized into 1 ms ticks.  Level 0 holds events due within
+// the next 64 ticks, each level above covers 64 times the span of the
+// one below; when the lower levels wrap around, the matching slot from
+// the level above is cascaded down.  Four levels cover a little over
+// four hours, anything further out is parked at the top level and
+// re-cascaded until it is in range.
+//
+// Callbacks are allowed to schedule and cancel other events.  Not
+// thread safe, it is intended to be owned and advanced by the game
+// model on the update thread.
+//
+// ------------------------------------------------------------------
+class TimingWheel
+{
+  public:
+    using TimerId = std::uint64_t;
+    using Callback = std::function<void()>;
+
+    static constexpr TimerId INVALID_TIMER = 0;
+
+    TimerId schedule(std::chrono::microseconds delay, Callback callback);
+    void cancel(TimerId id);
+    void advance(std::chrono::microseconds elapsedTime);
+    void clear();
+
+    auto now() const { return m_now; }
+    auto size() const { return m_timers.size() - m_free.size(); }
+
+  private:
+    static constexpr std::uint8_t LEVELS = 4;
+    static constexpr std::uint8_t SLOT_BITS = 6;
+    static constexpr std::uint64_t SLOTS = 1 << SLOT_BITS;
+    static constexpr std::uint64_t SLOT_MASK = SLOTS - 1;
+    static constexpr std::uint64_t MAX_DELTA = (std::uint64_t{ 1 } << (SLOT_BITS * LEVELS)) - 1;
+    static constexpr std::chrono::microseconds TICK{ 1000 };
+
+    struct Timer
+    {
+        std::uint64_t expires{ 0 };    // Tick the callback is due on
+        std::uint32_t generation{ 1 }; // Bumped every time the record is released, invalidates old ids
+        Callback callback;
+    };
+
+    // Slots only reference a timer record, the generation tells whether
+    // the reference is still live or was cancelled (or reused) since.
+    struct Entry
+    {
+        std::uint32_t index;
+        std::uint32_t generation;
+    };
+
+    std::chrono::microseconds m_now{ 0 };  // Simulation time
+    std::chrono::microseconds m_base{ 0 }; // Time new events are scheduled from
+    std::uint64_t m_tick{ 1 };             // Next tick to be processed
+
+    std::array<std::array<std::vector<Entry>, SLOTS>, LEVELS> m_wheel;
+    std::vector<Entry> m_firing;
+    std::vector<Timer> m_timers;
+    std::vector<std::uint32_t> m_free;
+
+    void insert(Entry entry, std::uint64_t expires);
+    void cascade(std::uint8_t level, std::uint64_t slot);
+    void release(std::uint32_t index);
+    bool isLive(const Entry& entry) const { return m_timers[entry.index].generation == entry.generation; }
+};
@@ -0,0 +1,88 @@
+/*
+Copyright (c) 2021 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+// ------------------------------------------------------------------
+//
+// @details A lock-free triple buffer for handing a value from one
+// producer thread to one consumer thread.  The producer always has a
+// buffer to write into and the consumer always has a buffer to read
+// from, nothing here ever blocks either of them.  A third buffer holds
+// the most recently published value; publishing and acquiring swap
+// buffers with it.  If the producer publishes more than once before
+// the consumer acquires, the older values are simply skipped.  Any
+// pacing between the two, such as RenderThread keeping the simulation
+// from getting more than one frame ahead, is up to the user, which can
+// wait on hasFresh.
+//
+// ------------------------------------------------------------------
+template <typename T>
+class TripleBuffer
+{
+  public:
+    // ------------------------------------------------------------------
+    //
+    // Producer side: the buffer to write the next value into, then
+    // call publish once it is complete.
+    //
+    // ------------------------------------------------------------------
+    T& getWriteBuffer() { return m_buffers[m_write]; }
+
+    void publish()
+    {
+        m_write = m_latest.exchange(m_write | FRESH) & INDEX;
+    }
+
+    // ------------------------------------------------------------------
+    //
+    // Consumer side: if a new value has been published since the last
+    // acquire, it becomes the read buffer and true is returned.
+    //
+    // ------------------------------------------------------------------
+    bool acquire()
+    {
+        if (!hasFresh())
+        {
+            return false;
+        }
+        m_read = m_latest.exchange(m_read) & INDEX;
+        return true;
+    }
+
+    const T& getReadBuffer() const { return m_buffers[m_read]; }
+
+    bool hasFresh() const { return (m_latest.load() & FRESH) != 0; }
+
+  private:
+    static constexpr std::uint8_t INDEX = 0x03;
+    static constexpr std::uint8_t FRESH = 0x04; // Set when the latest buffer hasn't been acquired yet
+
+    std::array<T, 3> m_buffers;
+    std::uint8_t m_write{ 0 };
+    std::uint8_t m_read{ 1 };
+    std::atomic<std::uint8_t> m_latest{ 2 };
+};
@@ -39,7 +39,7 @@ namespace renderers
         m_sprite->setRotation(orientation);
     }
 
-    void Background::render(sf::RenderTarget& renderTarget)
+    void Background::render(RenderFrame& renderTarget)
     {
         renderTarget.draw(*m_sprite);
     }
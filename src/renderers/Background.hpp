@@ -23,6 +23,7 @@ THE SOFTWARE.
 #pragma once
 
 #include "misc/math.hpp"
+#include "renderers/RenderFrame.hpp"
 
 #include <SFML/Graphics.hpp>
 #include <memory>
@@ -34,7 +35,7 @@ namespace renderers
       public:
         Background(std::shared_ptr<sf::Texture> texture, math::Dimension2f size, math::Point2f position, float orientation = 0.0f);
 
-        void render(sf::RenderTarget& renderTarget);
+        void render(RenderFrame& renderTarget);
 
       private:
         std::shared_ptr<sf::Sprite> m_sprite;
@@ -45,7 +45,7 @@ namespace renderers
         m_text->setPosition({ -m_text->getRegion().width / 2.0f, m_text->getRegion().top });
     }
 
-    void GameStatus::render(sf::RenderTarget& renderTarget)
+    void GameStatus::render(RenderFrame& renderTarget)
     {
         m_text->render(renderTarget);
     }
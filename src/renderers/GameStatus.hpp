@@ -23,6 +23,7 @@ THE SOFTWARE.
 #pragma once
 
 #include "UIFramework/Text.hpp"
+#include "renderers/RenderFrame.hpp"
 
 namespace renderers
 {
@@ -38,7 +39,7 @@ namespace renderers
         GameStatus();
 
         void setMessage(const std::string message);
-        void render(sf::RenderTarget& renderTarget);
+        void render(RenderFrame& renderTarget);
 
       private:
         std::shared_ptr<ui::Text> m_text;
@@ -48,7 +48,7 @@ namespace renderers
         //
         // Set the size and postion of the background panel for the remaining ship panel
         auto coords = Configuration::getGraphics().getViewCoordinates();
-        auto playerSize = Configuration::get<float>(config::PLAYER_SIZE);
+        auto playerSize = Configuration::getSnapshot().player.size;
         m_backgroundBots.setSize({ playerSize * 6.0f, playerSize * 2 });
         m_backgroundBots.setPosition({ coords.width / 2 - 7 * playerSize, -coords.height / 2 + coords.height * 0.10f - playerSize });
         m_backgroundBots.setFillColor(sf::Color(0, 0, 255, 100));
@@ -95,7 +95,48 @@ namespace renderers
             Configuration::get<std::uint8_t>(config::FONT_GAMEPLAY_SCORE_SIZE));
     }
 
-    void HUD::render(std::uint8_t howManyNanoBots, std::chrono::milliseconds timePlayed, std::uint32_t virusesKilled, sf::RenderTarget& renderTarget)
+    // --------------------------------------------------------------
+    //
+    // The text is only formatted and laid out again when the value it
+    // shows has changed, and the layer is only redrawn if the nano bots
+    // or viruses killed changed.
+    //
+    // --------------------------------------------------------------
+    void HUD::render(std::uint8_t howManyNanoBots, std::chrono::milliseconds timePlayed, std::uint32_t virusesKilled, RenderFrame& renderTarget)
+    {
+        auto centiseconds = timePlayed.count() / 10;
+        bool changed = m_dirty || howManyNanoBots != m_howManyNanoBots || virusesKilled != m_virusesKilled;
+
+        if (m_dirty || centiseconds != m_centiseconds)
+        {
+            m_textTime->setText(misc::timeToMMMSSString(timePlayed));
+        }
+        if (m_dirty || virusesKilled != m_virusesKilled)
+        {
+            //
+            // Center in the field
+            m_textKilled->setText(std::to_string(virusesKilled));
+            m_textKilled->setPosition({ m_backgroundViruses.getPosition().x + (m_backgroundViruses.getSize().x - m_textKilled->getRegion().width) / 2.0f,
+                                        m_backgroundViruses.getPosition().y + (m_backgroundViruses.getSize().y - m_textKilled->getRegion().height * 1.5f) / 2.0f });
+        }
+        m_dirty = false;
+        m_howManyNanoBots = howManyNanoBots;
+        m_centiseconds = centiseconds;
+        m_virusesKilled = virusesKilled;
+
+        if (changed)
+        {
+            m_layer.invalidate();
+        }
+        m_layer.render(renderTarget, [this](renderers::RenderFrame& frame)
+                       { renderPanels(frame); });
+
+        //
+        // Render how long played, on top of its panel in the layer
+        m_textTime->render(renderTarget);
+    }
+
+    void HUD::renderPanels(RenderFrame& renderTarget)
     {
         //
         // Get the remaining nano bots rendered.
@@ -103,7 +144,7 @@ namespace renderers
         renderTarget.draw(m_backgroundBots);
 
         auto coords = Configuration::getGraphics().getViewCoordinates();
-        for (auto bot = 1; bot <= howManyNanoBots; bot++)
+        for (auto bot = 1; bot <= m_howManyNanoBots; bot++)
         {
             auto whereX = bot * (5 + 1);
             m_spritePlayer->setPosition({ coords.width / 2 - whereX, -coords.height / 2 + coords.height * 0.10f });
@@ -111,21 +152,12 @@ namespace renderers
         }
 
         //
-        // Render how long played
+        // The panel for how long played, the time itself changes too often to be in the layer
         renderTarget.draw(m_backgroundTime);
 
-        m_textTime->setText(misc::timeToMMMSSString(timePlayed));
-        m_textTime->render(renderTarget);
-
         //
         // Render how many viruses killed
         renderTarget.draw(m_backgroundViruses);
-
-        //
-        // Center in the field
-        m_textKilled->setText(std::to_string(virusesKilled));
-        m_textKilled->setPosition({ m_backgroundViruses.getPosition().x + (m_backgroundViruses.getSize().x - m_textKilled->getRegion().width) / 2.0f,
-                                    m_backgroundViruses.getPosition().y + (m_backgroundViruses.getSize().y - m_textKilled->getRegion().height * 1.5f) / 2.0f });
         m_textKilled->render(renderTarget);
     }
 } // namespace renderers
@@ -22,7 +22,9 @@ THE SOFTWARE.
 
 #pragma once
 
+#include "UIFramework/Layer.hpp"
 #include "UIFramework/Text.hpp"
+#include "renderers/RenderFrame.hpp"
 
 #include <SFML/Graphics.hpp>
 #include <chrono>
@@ -35,13 +37,20 @@ namespace renderers
     //
     // Renders the in-game information for the player.
     //
+    // The panels are drawn into a retained layer that is only redrawn
+    // when the remaining nano bots or the viruses killed change.  The time
+    // played changes every frame, so its text is drawn on top of the layer
+    // rather than in it, and only laid out again when the centiseconds it
+    // shows change.  Every other frame the HUD is a single sprite and the
+    // time.
+    //
     // --------------------------------------------------------------
     class HUD
     {
       public:
         HUD();
 
-        void render(std::uint8_t howManyNanoBots, std::chrono::milliseconds timePlayed, std::uint32_t virusesKilled, sf::RenderTarget& renderTarget);
+        void render(std::uint8_t howManyNanoBots, std::chrono::milliseconds timePlayed, std::uint32_t virusesKilled, RenderFrame& renderTarget);
 
       private:
         std::shared_ptr<sf::Sprite> m_spritePlayer;
@@ -51,5 +60,14 @@ namespace renderers
 
         std::unique_ptr<ui::Text> m_textTime;
         std::unique_ptr<ui::Text> m_textKilled;
+
+        ui::Layer m_layer;
+
+        bool m_dirty{ true };
+        std::uint8_t m_howManyNanoBots{ 0 };
+        std::chrono::milliseconds::rep m_centiseconds{ 0 };
+        std::uint32_t m_virusesKilled{ 0 };
+
+        void renderPanels(RenderFrame& renderTarget);
     };
 } // namespace renderers
@@ -0,0 +1,187 @@
+/*
+Copyright (c) 2021 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "RenderFrame.hpp"
+
+#include <algorithm>
+#include <type_traits>
+
+namespace renderers
+{
+    // --------------------------------------------------------------
+    //
+    // Empties the frame for recording a new one.  The vectors keep their
+    // memory, so after the first few frames there is little allocation.
+    //
+    // --------------------------------------------------------------
+    void RenderFrame::reset(const sf::View& view)
+    {
+        m_view = view;
+        m_commands.clear();
+        m_vertices.clear();
+    }
+
+    void RenderFrame::clear(sf::Color color)
+    {
+        m_commands.push_back(Clear{ color });
+    }
+
+    void RenderFrame::draw(const sf::Sprite& sprite)
+    {
+        m_commands.push_back(sprite);
+    }
+
+    void RenderFrame::draw(const sf::Sprite& sprite, const sf::BlendMode& blendMode)
+    {
+        m_commands.push_back(BlendedSprite{ sprite, blendMode });
+    }
+
+    void RenderFrame::draw(const sf::RectangleShape& shape)
+    {
+        m_commands.push_back(shape);
+    }
+
+    // --------------------------------------------------------------
+    //
+    // Triangles drawn one after the other with the same states are merged
+    // into the previous draw, so for example all the text of a menu in the
+    // same font ends up as a single draw call.  Only back to back draws
+    // are merged, which keeps everything in the order it was drawn.
+    //
+    // --------------------------------------------------------------
+    void RenderFrame::draw(const sf::Vertex* vertices, std::size_t count, sf::PrimitiveType type, const sf::RenderStates& states)
+    {
+        auto last = m_commands.empty() ? nullptr : std::get_if<Vertices>(&m_commands.back());
+        if (last != nullptr && type == sf::Triangles && last->type == sf::Triangles && isSameState(last->states, states))
+        {
+            last->count += count;
+        }
+        else
+        {
+            m_commands.push_back(Vertices{ m_vertices.size(), count, type, states });
+        }
+        m_vertices.insert(m_vertices.end(), vertices, vertices + count);
+    }
+
+    bool RenderFrame::isSameState(const sf::RenderStates& lhs, const sf::RenderStates& rhs)
+    {
+        return lhs.texture == rhs.texture &&
+               lhs.shader == rhs.shader &&
+               lhs.blendMode == rhs.blendMode &&
+               std::equal(lhs.transform.getMatrix(), lhs.transform.getMatrix() + 16, rhs.transform.getMatrix());
+    }
+
+    // --------------------------------------------------------------
+    //
+    // The smallest rectangle, in world coordinates, that contains
+    // everything drawn so far.  Clears aren't drawn anywhere in particular,
+    // so they don't count.  Empty if nothing was drawn.
+    //
+    // --------------------------------------------------------------
+    sf::FloatRect RenderFrame::getBounds() const
+    {
+        bool empty{ true };
+        sf::Vector2f min;
+        sf::Vector2f max;
+        auto include = [&](const sf::Vector2f& point)
+        {
+            if (empty)
+            {
+                min = max = point;
+                empty = false;
+                return;
+            }
+            min = { std::min(min.x, point.x), std::min(min.y, point.y) };
+            max = { std::max(max.x, point.x), std::max(max.y, point.y) };
+        };
+        auto includeRect = [&](const sf::FloatRect& rect)
+        {
+            include({ rect.left, rect.top });
+            include({ rect.left + rect.width, rect.top + rect.height });
+        };
+
+        for (auto&& command : m_commands)
+        {
+            std::visit(
+                [&](auto&& item)
+                {
+                    using T = std::decay_t<decltype(item)>;
+                    if constexpr (std::is_same_v<T, BlendedSprite>)
+                    {
+                        includeRect(item.sprite.getGlobalBounds());
+                    }
+                    else if constexpr (std::is_same_v<T, Vertices>)
+                    {
+                        for (auto vertex = item.first; vertex < item.first + item.count; vertex++)
+                        {
+                            include(item.states.transform.transformPoint(m_vertices[vertex].position));
+                        }
+                    }
+                    else if constexpr (!std::is_same_v<T, Clear>)
+                    {
+                        includeRect(item.getGlobalBounds());
+                    }
+                },
+                command);
+        }
+
+        return empty ? sf::FloatRect() : sf::FloatRect(min, max - min);
+    }
+
+    // --------------------------------------------------------------
+    //
+    // Replays the recorded frame into the render target, in the same
+    // order it was recorded, through the view it was recorded with.
+    //
+    // --------------------------------------------------------------
+    void RenderFrame::render(sf::RenderTarget& renderTarget) const
+    {
+        renderTarget.setView(m_view);
+        for (auto&& command : m_commands)
+        {
+            std::visit(
+                [&](auto&& item)
+                {
+                    using T = std::decay_t<decltype(item)>;
+                    if constexpr (std::is_same_v<T, Clear>)
+                    {
+                        renderTarget.clear(item.color);
+                    }
+                    else if constexpr (std::is_same_v<T, BlendedSprite>)
+                    {
+                        renderTarget.draw(item.sprite, sf::RenderStates(item.blendMode));
+                    }
+                    else if constexpr (std::is_same_v<T, Vertices>)
+                    {
+                        renderTarget.draw(m_vertices.data() + item.first, item.count, item.type, item.states);
+                    }
+                    else
+                    {
+                        // Only drawables whose geometry is complete once copied can be replayed here
+                        static_assert(std::is_same_v<T, sf::Sprite> || std::is_same_v<T, sf::RectangleShape>);
+                        renderTarget.draw(item);
+                    }
+                },
+                command);
+        }
+    }
+} // namespace renderers
@@ -0,0 +1,92 @@
+/*
+Copyright (c) 2021 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <variant>
+#include <vector>
+
+namespace renderers
+{
+    // --------------------------------------------------------------
+    //
+    // A snapshot of everything drawn for one frame.  Views render into
+    // a frame on the simulation thread, recording copies of what was
+    // drawn rather than drawing it, and the render thread then replays
+    // the frame into the window.  Once recorded a frame is never
+    // changed, so the two threads don't have to share any game state.
+    //
+    // The draw methods mirror those of sf::RenderTarget that are used
+    // by the game, so rendering code reads the same as before.  The
+    // textures referred to belong to Content (or the texture atlas) and
+    // outlive any frame.
+    //
+    // Everything is recorded already laid out; replaying a command must
+    // not compute anything from shared state.  Text in particular is
+    // recorded as glyph quads, an sf::Text would build its glyphs from
+    // the sf::Font on the render thread while the main thread uses it.
+    //
+    // --------------------------------------------------------------
+    class RenderFrame
+    {
+      public:
+        void reset(const sf::View& view);
+        void setView(const sf::View& view) { m_view = view; }
+        const sf::View& getView() const { return m_view; }
+        sf::FloatRect getBounds() const;
+
+        void clear(sf::Color color = sf::Color::Black);
+        void draw(const sf::Sprite& sprite);
+        void draw(const sf::Sprite& sprite, const sf::BlendMode& blendMode);
+        void draw(const sf::RectangleShape& shape);
+        void draw(const sf::Vertex* vertices, std::size_t count, sf::PrimitiveType type, const sf::RenderStates& states);
+
+        void render(sf::RenderTarget& renderTarget) const;
+
+      private:
+        struct Clear
+        {
+            sf::Color color;
+        };
+        struct BlendedSprite
+        {
+            sf::Sprite sprite;
+            sf::BlendMode blendMode;
+        };
+        struct Vertices
+        {
+            std::size_t first; // Index into m_vertices
+            std::size_t count;
+            sf::PrimitiveType type;
+            sf::RenderStates states;
+        };
+        using Command = std::variant<Clear, sf::Sprite, BlendedSprite, sf::RectangleShape, Vertices>;
+
+        sf::View m_view;
+        std::vector<Command> m_commands;
+        std::vector<sf::Vertex> m_vertices; // Shared by all vertex commands, so its memory is reused frame to frame
+
+        static bool isSameState(const sf::RenderStates& lhs, const sf::RenderStates& rhs);
+    };
+} // namespace renderers
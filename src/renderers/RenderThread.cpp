@@ -0,0 +1,119 @@
+/*
+Copyright (c) 2021 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "RenderThread.hpp"
+
+namespace renderers
+{
+    RenderThread::RenderThread(std::shared_ptr<sf::RenderWindow> window) :
+        m_window(window)
+    {
+    }
+
+    // --------------------------------------------------------------
+    //
+    // The window's context can only be active on one thread at a time,
+    // so it is released here before the render thread takes it over.
+    //
+    // --------------------------------------------------------------
+    void RenderThread::start()
+    {
+        m_done = false;
+        m_window->setActive(false);
+        m_thread = std::make_unique<std::thread>(&RenderThread::run, this);
+    }
+
+    void RenderThread::stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutexFrames);
+            m_done = true;
+        }
+        m_eventFrames.notify_all();
+        m_thread->join();
+        m_thread = nullptr;
+    }
+
+    // --------------------------------------------------------------
+    //
+    // Returns the frame to record into.  If the render thread hasn't yet
+    // picked up the last frame, this waits for it.  The simulation is
+    // never more than one frame ahead of what is on the screen; without
+    // this it would run as fast as it can, only for most of its frames
+    // to be skipped.
+    //
+    // --------------------------------------------------------------
+    RenderFrame& RenderThread::beginFrame()
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutexFrames);
+            m_eventFrames.wait(lock, [this]()
+                               { return m_done || !m_frames.hasFresh(); });
+        }
+
+        auto& frame = m_frames.getWriteBuffer();
+        frame.reset(m_window->getView());
+        return frame;
+    }
+
+    void RenderThread::endFrame()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutexFrames);
+            m_frames.publish();
+        }
+        m_eventFrames.notify_all();
+    }
+
+    // --------------------------------------------------------------
+    //
+    // The render thread.  Takes the latest frame, lets the simulation
+    // know it can start on the next one, then draws and presents this
+    // one.  The simulation runs the next update while the present
+    // (and its wait on vsync) takes place.
+    //
+    // --------------------------------------------------------------
+    void RenderThread::run()
+    {
+        m_window->setActive(true);
+
+        while (!m_done)
+        {
+            bool acquired{ false };
+            {
+                std::unique_lock<std::mutex> lock(m_mutexFrames);
+                m_eventFrames.wait(lock, [this]()
+                                   { return m_done || m_frames.hasFresh(); });
+                acquired = m_frames.acquire();
+            }
+            m_eventFrames.notify_all();
+
+            if (acquired)
+            {
+                m_frames.getReadBuffer().render(*m_window);
+                m_window->display();
+            }
+        }
+
+        m_window->setActive(false);
+    }
+} // namespace renderers
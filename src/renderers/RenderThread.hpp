@@ -0,0 +1,75 @@
+/*
+Copyright (c) 2021 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "misc/TripleBuffer.hpp"
+#include "renderers/RenderFrame.hpp"
+
+#include <SFML/Graphics.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace renderers
+{
+    // --------------------------------------------------------------
+    //
+    // Owns the window's OpenGL context and presents frames on its own
+    // thread, so that waiting on vsync (or a slow present) doesn't hold up
+    // the simulation, and a slow simulation frame doesn't hold up the
+    // present of the one before it.
+    //
+    // The simulation thread records each frame into the buffer returned
+    // by beginFrame and hands it over with endFrame.  Frames are passed
+    // through a triple buffer, the render thread always presents the most
+    // recent complete frame.  beginFrame waits while a published frame
+    // hasn't been picked up yet, so the simulation is throttled to at most
+    // one frame ahead of the render thread.  Window events are still
+    // handled by the thread that created the window.
+    //
+    // --------------------------------------------------------------
+    class RenderThread
+    {
+      public:
+        RenderThread(std::shared_ptr<sf::RenderWindow> window);
+
+        void start();
+        void stop();
+
+        RenderFrame& beginFrame();
+        void endFrame();
+
+      private:
+        std::shared_ptr<sf::RenderWindow> m_window;
+        TripleBuffer<RenderFrame> m_frames;
+
+        std::atomic_bool m_done{ false };
+        std::unique_ptr<std::thread> m_thread;
+        std::mutex m_mutexFrames;
+        std::condition_variable m_eventFrames;
+
+        void run();
+    };
+} // namespace renderers
@@ -0,0 +1,165 @@
+/*
+Copyright (c) 2021 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "SpriteBatch.hpp"
+
+#include "services/TextureAtlas.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace renderers
+{
+    // --------------------------------------------------------------
+    //
+    // Empties the batches, but keeps them (and their memory) around
+    // for the next frame.  A batch that nothing was added to since the
+    // last clear is dropped, its texture may have been evicted from
+    // the content and the pointer reused by a different one.
+    //
+    // --------------------------------------------------------------
+    void SpriteBatch::clear()
+    {
+        auto unused = std::remove_if(m_batches.begin(), m_batches.end(),
+                                     [](const auto& batch)
+                                     {
+                                         return batch.vertices.empty();
+                                     });
+        if (unused != m_batches.end())
+        {
+            m_batches.erase(unused, m_batches.end());
+            m_batchIndex.clear();
+            for (std::size_t index = 0; index < m_batches.size(); index++)
+            {
+                m_batchIndex[m_batches[index].texture] = index;
+            }
+        }
+
+        for (auto&& batch : m_batches)
+        {
+            batch.vertices.clear();
+        }
+    }
+
+    // --------------------------------------------------------------
+    //
+    // Quads that aren't inside this view are culled from here on.  Usually
+    // this is the view of the target the batch is about to be rendered to.
+    //
+    // --------------------------------------------------------------
+    void SpriteBatch::setView(const sf::View& view)
+    {
+        m_cull = true;
+        m_view = sf::FloatRect(view.getCenter() - view.getSize() / 2.0f, view.getSize());
+    }
+
+    // --------------------------------------------------------------
+    //
+    // Tests a bounding circle against the view.  The view is grown by the
+    // radius and the center tested against that, which is conservative near
+    // the corners, but that only means a few off-screen quads are drawn.
+    //
+    // --------------------------------------------------------------
+    bool SpriteBatch::isVisible(math::Point2f center, float radius) const
+    {
+        return !m_cull ||
+               (center.x + radius >= m_view.left && center.x - radius <= m_view.left + m_view.width &&
+                center.y + radius >= m_view.top && center.y - radius <= m_view.top + m_view.height);
+    }
+
+    // --------------------------------------------------------------
+    //
+    // Adds a quad, as two triangles, centered at 'center' and rotated by
+    // 'rotation' degrees.  Only the 'textureRect' part of the texture
+    // is drawn, allowing sprite sheets to be used.  If the texture has
+    // been packed into the TextureAtlas, the quad is drawn from the
+    // atlas instead, so it shares a batch with everything else there.
+    //
+    // --------------------------------------------------------------
+    void SpriteBatch::add(const sf::Texture* texture, const sf::IntRect& textureRect, math::Point2f center, math::Dimension2f size, float rotation, sf::Color color)
+    {
+        // Half the diagonal bounds the quad at any rotation
+        if (!isVisible(center, std::sqrt(size.width * size.width + size.height * size.height) / 2.0f))
+        {
+            return;
+        }
+
+        auto rect = textureRect;
+        if (auto region = TextureAtlas::instance().find(texture); region)
+        {
+            texture = region->texture;
+            rect.left += region->rect.left;
+            rect.top += region->rect.top;
+        }
+
+        auto itr = m_batchIndex.find(texture);
+        if (itr == m_batchIndex.end())
+        {
+            itr = m_batchIndex.insert({ texture, m_batches.size() }).first;
+            m_batches.push_back({ texture, {} });
+        }
+        auto& vertices = m_batches[itr->second].vertices;
+
+        auto radians = math::toRadians(rotation);
+        auto cosTheta = std::cos(radians);
+        auto sinTheta = std::sin(radians);
+        auto halfWidth = size.width / 2.0f;
+        auto halfHeight = size.height / 2.0f;
+        auto corner = [&](float x, float y)
+        {
+            return sf::Vector2f(center.x + x * cosTheta - y * sinTheta, center.y + x * sinTheta + y * cosTheta);
+        };
+
+        auto left = static_cast<float>(rect.left);
+        auto top = static_cast<float>(rect.top);
+        auto right = left + rect.width;
+        auto bottom = top + rect.height;
+
+        sf::Vertex topLeft(corner(-halfWidth, -halfHeight), color, { left, top });
+        sf::Vertex topRight(corner(halfWidth, -halfHeight), color, { right, top });
+        sf::Vertex bottomRight(corner(halfWidth, halfHeight), color, { right, bottom });
+        sf::Vertex bottomLeft(corner(-halfWidth, halfHeight), color, { left, bottom });
+
+        vertices.push_back(topLeft);
+        vertices.push_back(topRight);
+        vertices.push_back(bottomRight);
+        vertices.push_back(topLeft);
+        vertices.push_back(bottomRight);
+        vertices.push_back(bottomLeft);
+    }
+
+    void SpriteBatch::add(const sf::Texture* texture, math::Point2f center, math::Dimension2f size, float rotation, sf::Color color)
+    {
+        add(texture, { 0, 0, static_cast<int>(texture->getSize().x), static_cast<int>(texture->getSize().y) }, center, size, rotation, color);
+    }
+
+    void SpriteBatch::render(RenderFrame& renderTarget)
+    {
+        for (auto&& batch : m_batches)
+        {
+            if (!batch.vertices.empty())
+            {
+                renderTarget.draw(batch.vertices.data(), batch.vertices.size(), sf::Triangles, sf::RenderStates(batch.texture));
+            }
+        }
+    }
+} // namespace renderers
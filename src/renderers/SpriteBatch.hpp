@@ -0,0 +1,71 @@
+/*
+Copyright (c) 2021 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "misc/math.hpp"
+#include "renderers/RenderFrame.hpp"
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+namespace renderers
+{
+    // --------------------------------------------------------------
+    //
+    // Collects textured quads and draws them with one draw call per
+    // texture, rather than one draw call per sprite.  Quads are already
+    // transformed to view coordinates when they are added, sized in
+    // the same units as the components::Size of an entity.
+    //
+    // Usage each frame is: clear, add as many quads as needed, render.
+    // Once a view has been set, quads that fall entirely outside of it
+    // are culled as they are added.  The vertex storage is kept between frames, so once it has grown
+    // to the size needed, no more allocations take place; a texture that goes a frame without any
+    // quads loses its batch.
+    //
+    // --------------------------------------------------------------
+    class SpriteBatch
+    {
+      public:
+        void clear();
+        void setView(const sf::View& view);
+        bool isVisible(math::Point2f center, float radius) const;
+        void add(const sf::Texture* texture, const sf::IntRect& textureRect, math::Point2f center, math::Dimension2f size, float rotation, sf::Color color = sf::Color::White);
+        void add(const sf::Texture* texture, math::Point2f center, math::Dimension2f size, float rotation, sf::Color color = sf::Color::White);
+        void render(RenderFrame& renderTarget);
+
+      private:
+        struct Batch
+        {
+            const sf::Texture* texture;
+            std::vector<sf::Vertex> vertices;
+        };
+        std::vector<Batch> m_batches; // Rendered in the order the textures were first added
+        std::unordered_map<const sf::Texture*, std::size_t> m_batchIndex;
+
+        bool m_cull{ false };
+        sf::FloatRect m_view;
+    };
+} // namespace renderers
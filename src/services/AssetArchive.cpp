@@ -0,0 +1,215 @@
+/*
+Copyright (c) 2021 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "services/AssetArchive.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+#if defined(_WIN32)
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+AssetArchive::~AssetArchive()
+{
+    close();
+}
+
+// --------------------------------------------------------------
+//
+// Maps the archive and validates its header and index.  If anything
+// about it doesn't look right, the archive is left closed and false
+// is returned; the caller is expected to fall back to loose files.
+//
+// --------------------------------------------------------------
+bool AssetArchive::open(const std::string& filename)
+{
+    close();
+    if (!map(filename))
+    {
+        return false;
+    }
+
+    auto valid = [this]()
+    {
+        if (m_size < sizeof(Header))
+        {
+            return false;
+        }
+        Header header;
+        std::memcpy(&header, m_data, sizeof(Header));
+        if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION)
+        {
+            return false;
+        }
+        if (sizeof(Header) + static_cast<std::uint64_t>(header.count) * sizeof(Entry) > m_size)
+        {
+            return false;
+        }
+        m_entries = reinterpret_cast<const Entry*>(m_data + sizeof(Header));
+        m_count = header.count;
+
+        return std::all_of(m_entries, m_entries + m_count, [this](const Entry& entry)
+                           { return entry.name[NAME_LENGTH - 1] == '\0' && entry.offset <= m_size && entry.size <= m_size - entry.offset; });
+    };
+
+    if (!valid())
+    {
+        std::cout << "invalid asset archive: " << filename << std::endl;
+        close();
+        return false;
+    }
+
+    return true;
+}
+
+void AssetArchive::close()
+{
+    unmap();
+    m_entries = nullptr;
+    m_count = 0;
+}
+
+// --------------------------------------------------------------
+//
+// Binary search of the index for the named asset.
+//
+// --------------------------------------------------------------
+std::optional<AssetArchive::Asset> AssetArchive::find(const std::string& name) const
+{
+    if (!isOpen())
+    {
+        return std::nullopt;
+    }
+
+    auto end = m_entries + m_count;
+    auto entry = std::lower_bound(m_entries, end, name, [](const Entry& entry, const std::string& name)
+                                  { return std::strcmp(entry.name, name.c_str()) < 0; });
+    if (entry == end || name != entry->name)
+    {
+        return std::nullopt;
+    }
+
+    return Asset{ m_data + entry->offset, static_cast<std::size_t>(entry->size) };
+}
+
+#if defined(_WIN32)
+
+bool AssetArchive::map(const std::string& filename)
+{
+    auto file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+    {
+        CloseHandle(file);
+        return false;
+    }
+    auto mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr)
+    {
+        CloseHandle(file);
+        return false;
+    }
+    auto data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (data == nullptr)
+    {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    m_file = file;
+    m_mapping = mapping;
+    m_data = static_cast<const std::uint8_t*>(data);
+    m_size = static_cast<std::size_t>(size.QuadPart);
+
+    return true;
+}
+
+void AssetArchive::unmap()
+{
+    if (m_data != nullptr)
+    {
+        UnmapViewOfFile(m_data);
+        CloseHandle(m_mapping);
+        CloseHandle(m_file);
+    }
+    m_data = nullptr;
+    m_size = 0;
+    m_mapping = nullptr;
+    m_file = nullptr;
+}
+
+#else
+
+bool AssetArchive::map(const std::string& filename)
+{
+    auto file = ::open(filename.c_str(), O_RDONLY);
+    if (file < 0)
+    {
+        return false;
+    }
+    struct stat info;
+    if (fstat(file, &info) != 0 || info.st_size == 0)
+    {
+        ::close(file);
+        return false;
+    }
+    auto data = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+    // The mapping keeps its own reference to the file
+    ::close(file);
+    if (data == MAP_FAILED)
+    {
+        return false;
+    }
+    // Assets are read front to back, let the kernel read ahead
+    madvise(data, static_cast<std::size_t>(info.st_size), MADV_SEQUENTIAL);
+
+    m_data = static_cast<const std::uint8_t*>(data);
+    m_size = static_cast<std::size_t>(info.st_size);
+
+    return true;
+}
+
+void AssetArchive::unmap()
+{
+    if (m_data != nullptr)
+    {
+        munmap(const_cast<std::uint8_t*>(m_data), m_size);
+    }
+    m_data = nullptr;
+    m_size = 0;
+}
+
+#endif
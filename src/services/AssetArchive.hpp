@@ -0,0 +1,97 @@
+/*
+Copyright (c) 2021 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+// --------------------------------------------------------------
+//
+// Read-only view of the packed asset archive built by the PackAssets
+// tool.  The whole file is memory mapped and assets are returned as
+// pointers into the mapping, so they can be handed directly to the
+// SFML loadFromMemory/openFromMemory methods.
+//
+// Layout of the archive:
+//   Header
+//   Entry[count], sorted by name
+//   asset data, each one aligned to DATA_ALIGNMENT
+//
+// Names are the asset path relative to the assets folder, using '/'
+// as the separator, e.g. "images/petri-1.png".
+//
+// --------------------------------------------------------------
+class AssetArchive
+{
+  public:
+    static constexpr char MAGIC[8]{ 'N', 'A', 'N', 'O', 'P', 'A', 'K', '\0' };
+    static constexpr std::uint32_t VERSION{ 1 };
+    static constexpr std::size_t NAME_LENGTH{ 48 };
+    static constexpr std::uint64_t DATA_ALIGNMENT{ 16 };
+
+    struct Header
+    {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t count;
+    };
+
+    struct Entry
+    {
+        char name[NAME_LENGTH]; // Null terminated
+        std::uint64_t offset;   // From the start of the archive
+        std::uint64_t size;
+    };
+
+    struct Asset
+    {
+        const void* data;
+        std::size_t size;
+    };
+
+    AssetArchive() = default;
+    AssetArchive(const AssetArchive&) = delete;
+    AssetArchive& operator=(const AssetArchive&) = delete;
+    ~AssetArchive();
+
+    bool open(const std::string& filename);
+    void close();
+    bool isOpen() const { return m_data != nullptr; }
+
+    std::optional<Asset> find(const std::string& name) const;
+
+  private:
+    const std::uint8_t* m_data{ nullptr };
+    std::size_t m_size{ 0 };
+    const Entry* m_entries{ nullptr };
+    std::uint32_t m_count{ 0 };
+#if defined(_WIN32)
+    void* m_file{ nullptr };
+    void* m_mapping{ nullptr };
+#endif
+
+    bool map(const std::string& filename);
+    void unmap();
+};
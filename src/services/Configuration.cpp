@@ -26,8 +26,13 @@ THE SOFTWARE.
 
 #include <chrono>
 #include <cstdint>
+#include <iostream>
 #include <rapidjson/prettywriter.h>
 #include <rapidjson/stringbuffer.h>
+#include <type_traits>
+
+// Generated by the build from client.developer.json, defines CONFIGURATION_GAME
+#include "ConfigurationGame.inc"
 
 Configuration* Configuration::m_instance{ nullptr };
 
@@ -47,31 +52,54 @@ Configuration* Configuration::m_instance{ nullptr };
 // because that means the game is massively popular and someone
 // wanted to hack it!
 //
-// Online tool to convert JSON to a C++ string: https://tools.knowledgewalls.com/jsontostring
+// The embedded data is the developer json compiled into a blob by the
+// CompileConfiguration tool as part of the build, so a release build
+// doesn't parse any of the game configuration at startup.  The user
+// settings are parsed into their own DOM, which is also what is saved
+// when they are changed.
 //
 // --------------------------------------------------------------
 bool Configuration::initialize(const std::string_view jsonSettings, const std::string_view jsonDeveloper)
 {
-    std::string jsonFull;
-    // If running with a release json file, have to merge in the hard-coded settings
+    m_domSettings.Parse(jsonSettings.data(), jsonSettings.size());
+    if (m_domSettings.HasParseError())
+    {
+        std::cout << "unable to parse the settings configuration" << std::endl;
+        return false;
+    }
+
     if (jsonDeveloper.length() == 0)
     {
-        // When updating remember:
-        //  1.  Remove the leading {
-        //  2.  Add a leading ,
-        static const std::string jsonGame = ",\"developer\":{\"main-menu\":true},\"content\":{\"font\":{\"title\":{\"filename\":\"Shojumaru-Regular.ttf\",\"size\":60},\"menu\":{\"filename\":\"Shojumaru-Regular.ttf\",\"size\":40},\"level-select\":{\"filename\":\"Shojumaru-Regular.ttf\",\"title-size\":40,\"item-size\":24},\"game-status\":{\"filename\":\"Shojumaru-Regular.ttf\",\"size\":40},\"credits\":{\"filename\":\"Shojumaru-Regular.ttf\",\"title-size\":22,\"item-size\":36},\"settings\":{\"filename\":\"Shojumaru-Regular.ttf\",\"item-size\":36,\"message-size\":24},\"leaderboards\":{\"filename\":\"Shojumaru-Regular.ttf\",\"selection-size\":36,\"header-size\":32,\"entry-size\":28},\"gameplay\":{\"filename\":\"Shojumaru-Regular.ttf\",\"score-size\":24}},\"audio\":{\"menu\":{\"activate\":\"menu-activate.wav\",\"accept\":\"menu-accept.wav\"}},\"image\":{\"menu-background\":\"menu-background-2.jpg\"}},\"entity\":{\"player\":{\"thrust-rate\":1.0e-10,\"max-speed\":3.0e-5,\"drag-rate\":5.0e-9,\"rotate-rate\":0.00025,\"size\":3,\"image\":{\"ship\":\"playerShip1_blue.png\",\"destroy-particle\":\"virus-particle.png\",\"start-particle\":\"player-start-particle.png\"},\"audio\":{\"thrust\":\"thruster-level3.ogg\",\"death\":\"player-death.ogg\",\"start\":\"player-start.wav\"}},\"sars-cov2\":{\"rotate-rate\":0.02,\"speed\":1.25e-5,\"size\":{\"min\":0.5,\"max\":4},\"health\":{\"start\":4,\"increments\":24,\"increment-time\":1000},\"age-maturity\":20000,\"gestation\":{\"min\":2000,\"mean\":10000,\"stdev\":4000},\"image\":{\"virus\":\"sars-cov-2.png\",\"particle\":\"virus-particle.png\"},\"audio\":{\"death\":\"virus-death.ogg\"}},\"basic-gun\":{\"fire-delay\":200,\"damage\":1,\"lifetime\":2000,\"size\":0.45,\"image\":{\"bullet\":\"antibody.png\"},\"audio\":{\"fire\":\"fire.ogg\"}},\"rapid-fire\":{\"fire-delay\":100,\"damage\":1,\"lifetime\":2000,\"size\":0.45,\"image\":{\"bullet\":\"antibody.png\"},\"audio\":{\"fire\":\"fire.ogg\"},\"powerup\":{\"size\":2,\"lifetime\":15000,\"image\":\"powerup-rapid-fire.png\",\"sprite-count\":6,\"sprite-time\":100,\"audio\":\"powerup.ogg\"}},\"spread-fire\":{\"fire-delay\":200,\"damage\":1,\"lifetime\":2000,\"size\":0.45,\"image\":{\"bullet\":\"antibody.png\"},\"audio\":{\"fire\":\"fire.ogg\"},\"powerup\":{\"size\":2,\"lifetime\":20000,\"image\":\"powerup-spread-fire.png\",\"sprite-count\":6,\"sprite-time\":100,\"audio\":\"powerup.ogg\"}},\"bomb\":{\"fire-delay\":1000,\"damage\":0,\"lifetime\":1000,\"size\":1.5,\"bullets\":{\"count\":40,\"damage\":1,\"size\":0.45,\"lifetime\":2000},\"image\":{\"bullet\":\"bomb.png\"},\"audio\":{\"fire\":\"fire-bomb.ogg\",\"explode\":\"explode-bomb.ogg\"},\"powerup\":{\"size\":2,\"lifetime\":25000,\"image\":\"powerup-bomb.png\",\"sprite-count\":6,\"sprite-time\":100,\"audio\":\"powerup.ogg\"}}},\"levels\":{\"training-1\":{\"name\":\"Familiarization\",\"content\":{\"image\":{\"background\":\"petri-1.png\"},\"music\":{\"background\":\"background-music-2.ogg\"},\"messages\":{\"ready\":\"prepare for training\",\"failure\":\"more training needed\",\"success\":\"training successful\"}},\"settings\":{\"initial-virus-count\":2,\"max-virus-count\":3,\"nano-bot-count\":3,\"min-powerup-time\":0,\"bomb-powerup-time\":0,\"rapid-fire-powerup-time\":0,\"spread-fire-powerup-time\":0,\"leaderboard-max-viruses-killed\":0}},\"training-2\":{\"name\":\"Bomb\",\"content\":{\"image\":{\"background\":\"petri-1.png\"},\"music\":{\"background\":\"background-music-2.ogg\"},\"messages\":{\"ready\":\"look for the bomb powerup\",\"failure\":\"more training needed\",\"success\":\"training successful\"}},\"settings\":{\"initial-virus-count\":3,\"max-virus-count\":5,\"nano-bot-count\":3,\"min-powerup-time\":0,\"bomb-powerup-time\":20000,\"rapid-fire-powerup-time\":0,\"spread-fire-powerup-time\":0,\"leaderboard-max-viruses-killed\":0}},\"training-3\":{\"name\":\"Rapid Fire\",\"content\":{\"image\":{\"background\":\"petri-1.png\"},\"music\":{\"background\":\"background-music-2.ogg\"},\"messages\":{\"ready\":\"look for the rapid fire upgrade\",\"failure\":\"more training needed\",\"success\":\"training successful\"}},\"settings\":{\"initial-virus-count\":3,\"max-virus-count\":6,\"nano-bot-count\":3,\"min-powerup-time\":0,\"bomb-powerup-time\":0,\"rapid-fire-powerup-time\":20000,\"spread-fire-powerup-time\":0,\"leaderboard-max-viruses-killed\":0}},\"training-4\":{\"name\":\"Spread Fire\",\"content\":{\"image\":{\"background\":\"petri-1.png\"},\"music\":{\"background\":\"background-music-2.ogg\"},\"messages\":{\"ready\":\"look for the spread fire upgrade\",\"failure\":\"more training needed\",\"success\":\"training successful\"}},\"settings\":{\"initial-virus-count\":3,\"max-virus-count\":6,\"nano-bot-count\":3,\"min-powerup-time\":0,\"bomb-powerup-time\":0,\"rapid-fire-powerup-time\":0,\"spread-fire-powerup-time\":20000,\"leaderboard-max-viruses-killed\":0}},\"training-5\":{\"name\":\"Final Checkout\",\"content\":{\"image\":{\"background\":\"petri-5.png\"},\"music\":{\"background\":\"background-music-2.ogg\"},\"messages\":{\"ready\":\"prepare for final training\",\"failure\":\"more training needed\",\"success\":\"training successful\"}},\"settings\":{\"initial-virus-count\":4,\"max-virus-count\":8,\"nano-bot-count\":3,\"min-powerup-time\":5000,\"bomb-powerup-time\":30000,\"rapid-fire-powerup-time\":30000,\"spread-fire-powerup-time\":30000,\"leaderboard-max-viruses-killed\":0}},\"patient-1\":{\"name\":\"Newly Infected\",\"content\":{\"image\":{\"background\":\"petri-2.png\"},\"music\":{\"background\":\"background-music-1.ogg\"},\"messages\":{\"ready\":\"prepare for battle\",\"failure\":\"patient in danger of dying\",\"success\":\"Patient has recovered\"}},\"settings\":{\"initial-virus-count\":3,\"max-virus-count\":10,\"nano-bot-count\":3,\"min-powerup-time\":5000,\"bomb-powerup-time\":30000,\"rapid-fire-powerup-time\":30000,\"spread-fire-powerup-time\":30000,\"leaderboard-max-viruses-killed\":20}},\"patient-2\":{\"name\":\"On Ventilator\",\"content\":{\"image\":{\"background\":\"petri-3.png\"},\"music\":{\"background\":\"background-music-1.ogg\"},\"messages\":{\"ready\":\"prepare for battle\",\"failure\":\"patient in danger of dying\",\"success\":\"Patient has recovered\"}},\"settings\":{\"initial-virus-count\":6,\"max-virus-count\":14,\"nano-bot-count\":3,\"min-powerup-time\":7500,\"bomb-powerup-time\":40000,\"rapid-fire-powerup-time\":40000,\"spread-fire-powerup-time\":40000,\"leaderboard-max-viruses-killed\":30}},\"patient-3\":{\"name\":\"Near Death\",\"content\":{\"image\":{\"background\":\"petri-4.png\"},\"music\":{\"background\":\"background-music-1.ogg\"},\"messages\":{\"ready\":\"prepare for battle\",\"failure\":\"patient has died\",\"success\":\"Patient has recovered\"}},\"settings\":{\"initial-virus-count\":8,\"max-virus-count\":18,\"nano-bot-count\":3,\"min-powerup-time\":10000,\"bomb-powerup-time\":50000,\"rapid-fire-powerup-time\":50000,\"spread-fire-powerup-time\":50000,\"leaderboard-max-viruses-killed\":50}}}}";
-        std::string_view json1 = jsonSettings.substr(0, jsonSettings.size() - 2);
-        jsonFull = std::string(json1) + jsonGame;
+        m_game.open(CONFIGURATION_GAME, sizeof(CONFIGURATION_GAME));
     }
     else
     {
-        std::string_view json1 = jsonSettings.substr(0, jsonSettings.size() - 2);
-        std::string_view json2 = jsonDeveloper.substr(1, jsonDeveloper.size() - 1);
-        jsonFull = std::string(json1) + ", " + std::string(json2);
+        rapidjson::Document domDeveloper;
+        domDeveloper.Parse(jsonDeveloper.data(), jsonDeveloper.size());
+        if (domDeveloper.HasParseError())
+        {
+            std::cout << "unable to parse the developer configuration" << std::endl;
+            return false;
+        }
+        m_gameCompiled = ConfigurationBlob::compile(domDeveloper);
+        m_game.open(m_gameCompiled.data(), m_gameCompiled.size());
+    }
+    if (!m_game.isOpen())
+    {
+        std::cout << "the game configuration is not valid" << std::endl;
+        return false;
     }
 
-    m_domFull.Parse(jsonFull.data());
-    m_domSettings.Parse(jsonSettings.data());
+    if (!resolvePaths())
+    {
+        std::cout << "the configuration is missing required settings" << std::endl;
+        return false;
+    }
+    if (!compileSnapshot())
+    {
+        std::cout << "the configuration is missing game-play settings" << std::endl;
+        return false;
+    }
 
     //
     // Have to call this because the resolution and scale-to-resolution settings are needed in
@@ -100,16 +128,17 @@ std::string Configuration::serialize()
 
 // --------------------------------------------------------------
 //
-// Helper method used to find the member iteration in the rapidJSON document.
+// Helper method used to find a value in the rapidJSON document,
+// returns nullptr if it isn't there.
 //
 // --------------------------------------------------------------
-auto findValue(rapidjson::Document& dom, const std::vector<std::string>& path)
+rapidjson::Value* findValue(rapidjson::Value& dom, const std::vector<std::string>& path)
 {
-    auto itr = path.begin();
-    auto node = dom.FindMember(itr->c_str());
-    while (++itr != path.end())
+    rapidjson::Value* node = &dom;
+    for (auto itr = path.begin(); node != nullptr && itr != path.end(); itr++)
     {
-        node = node->value.FindMember(itr->c_str());
+        auto member = node->IsObject() ? node->FindMember(itr->c_str()) : node->MemberEnd();
+        node = (member != node->MemberEnd()) ? &member->value : nullptr;
     }
 
     return node;
@@ -117,100 +146,313 @@ auto findValue(rapidjson::Document& dom, const std::vector<std::string>& path)
 
 // --------------------------------------------------------------
 //
-// Various template specializations for get<>ing and set<>ing values
-// in the configuration.
+// Reads a value from either the settings DOM or the game configuration
+// blob, they have the same accessors.  RapidJson has differently named
+// methods for obtaining the different data types, hence the chain.
 //
 // --------------------------------------------------------------
-template <>
-bool Configuration::get(const std::vector<std::string>& path)
+template <typename T, typename V>
+T readValue(const V& value)
 {
-    return findValue(instance()->m_domFull, path)->value.GetBool();
+    if constexpr (std::is_same_v<T, bool>)
+    {
+        return value.GetBool();
+    }
+    else if constexpr (std::is_same_v<T, std::string>)
+    {
+        return value.GetString();
+    }
+    else if constexpr (std::is_same_v<T, std::chrono::milliseconds>)
+    {
+        return std::chrono::milliseconds(static_cast<std::uint32_t>(value.GetUint()));
+    }
+    else if constexpr (std::is_floating_point_v<T>)
+    {
+        return static_cast<T>(value.GetDouble());
+    }
+    else if constexpr (std::is_signed_v<T>)
+    {
+        return static_cast<T>(value.GetInt());
+    }
+    else
+    {
+        return static_cast<T>(value.GetUint());
+    }
 }
 
-template <>
-std::string Configuration::get(const std::vector<std::string>& path)
+// --------------------------------------------------------------
+//
+// Reports whether or not the path exists in the configuration.  Used
+// for settings that are optional, such as the parameters of a
+// particle effect emitter.
+//
+// --------------------------------------------------------------
+bool Configuration::has(const std::vector<std::string>& path)
 {
-    return findValue(instance()->m_domFull, path)->value.GetString();
+    return findValue(instance()->m_domSettings, path) != nullptr || instance()->m_game.find(path) != nullptr;
 }
 
-template <>
-std::uint8_t Configuration::get(const std::vector<std::string>& path)
+// --------------------------------------------------------------
+//
+// Returns the names of the members of the object at the path, in
+// the same order they appear in the configuration.
+//
+// --------------------------------------------------------------
+std::vector<std::string> Configuration::getMembers(const std::vector<std::string>& path)
 {
-    return static_cast<std::uint8_t>(findValue(instance()->m_domFull, path)->value.GetUint());
-}
+    std::vector<std::string> names;
+    if (auto node = findValue(instance()->m_domSettings, path); node != nullptr)
+    {
+        for (auto member = node->MemberBegin(); member != node->MemberEnd(); member++)
+        {
+            names.push_back(member->name.GetString());
+        }
+    }
+    else if (auto node = instance()->m_game.find(path); node != nullptr)
+    {
+        names = instance()->m_game.getMembers(*node);
+    }
 
-template <>
-std::uint16_t Configuration::get(const std::vector<std::string>& path)
-{
-    return static_cast<std::uint16_t>(findValue(instance()->m_domFull, path)->value.GetUint());
+    return names;
 }
 
-template <>
-std::uint32_t Configuration::get(const std::vector<std::string>& path)
+// --------------------------------------------------------------
+//
+// Resolves each of the fixed paths to its node, so get and set never
+// have to search for them.  A user setting is found in the settings
+// DOM, everything else in the game configuration.
+//
+// Every fixed path is required.  All of the missing ones are reported
+// and false returned, rather than leaving a null node for get to
+// dereference later on.
+//
+// --------------------------------------------------------------
+bool Configuration::resolvePaths()
 {
-    return static_cast<std::uint32_t>(findValue(instance()->m_domFull, path)->value.GetUint());
+    bool valid = true;
+    for (std::size_t id = 0; id < config::FIXED_PATH_COUNT; id++)
+    {
+        std::vector<std::string> path;
+        std::string_view remaining = config::FIXED_PATHS[id];
+        while (!remaining.empty())
+        {
+            auto end = remaining.find('/');
+            path.emplace_back(remaining.substr(0, end));
+            remaining = (end == std::string_view::npos) ? std::string_view() : remaining.substr(end + 1);
+        }
+
+        m_nodesSettings[id] = findValue(m_domSettings, path);
+        m_nodesGame[id] = m_game.find(path);
+        if (m_nodesSettings[id] == nullptr && m_nodesGame[id] == nullptr)
+        {
+            std::cout << "configuration setting not found: " << config::FIXED_PATHS[id] << std::endl;
+            valid = false;
+        }
+    }
+
+    return valid;
 }
 
+// --------------------------------------------------------------
+//
+// Various template specializations for writing values to the
+// settings.
+//
+// --------------------------------------------------------------
 template <>
-int Configuration::get(const std::vector<std::string>& path)
+void Configuration::write(rapidjson::Value& node, std::string value, rapidjson::Document& dom)
 {
-    return static_cast<int>(findValue(instance()->m_domFull, path)->value.GetInt());
+    node.SetString(value.c_str(), static_cast<rapidjson::SizeType>(value.size()), dom.GetAllocator());
 }
 
 template <>
-float Configuration::get(const std::vector<std::string>& path)
+void Configuration::write(rapidjson::Value& node, std::uint16_t value, rapidjson::Document&)
 {
-    return static_cast<float>(findValue(instance()->m_domFull, path)->value.GetDouble());
+    node.SetUint(value);
 }
 
 template <>
-double Configuration::get(const std::vector<std::string>& path)
+void Configuration::write(rapidjson::Value& node, std::uint8_t value, rapidjson::Document&)
 {
-    return static_cast<double>(findValue(instance()->m_domFull, path)->value.GetDouble());
+    node.SetUint(value);
 }
 
 template <>
-std::chrono::milliseconds Configuration::get(const std::vector<std::string>& path)
+void Configuration::write(rapidjson::Value& node, bool value, rapidjson::Document&)
 {
-    auto ms = static_cast<std::uint32_t>(findValue(instance()->m_domFull, path)->value.GetUint());
-    return std::chrono::milliseconds(ms);
+    node.SetBool(value);
 }
 
 template <>
-void Configuration::set(const std::vector<std::string>& path, std::string value)
+void Configuration::write(rapidjson::Value& node, float value, rapidjson::Document&)
 {
-    // Modify values in both, because when serialization takes place, want the
-    // changed values to persist.
-    findValue(instance()->m_domFull, path)->value.SetString(value.c_str(), static_cast<rapidjson::SizeType>(value.size()), instance()->m_domFull.GetAllocator());
-    findValue(instance()->m_domSettings, path)->value.SetString(value.c_str(), static_cast<rapidjson::SizeType>(value.size()), instance()->m_domSettings.GetAllocator());
+    node.SetDouble(value);
 }
 
-template <>
-void Configuration::set(const std::vector<std::string>& path, std::uint16_t value)
+// --------------------------------------------------------------
+//
+// The fixed paths go straight to their resolved node, paths built at
+// runtime have to search.  A user setting takes precedence over the
+// game configuration.  A runtime path that isn't in either one is
+// reported and a default value returned; compileSnapshot then fails
+// the initialization.  Optional settings are checked with has first.
+//
+// --------------------------------------------------------------
+template <typename T>
+T Configuration::get(config::Path path)
 {
-    findValue(instance()->m_domFull, path)->value.SetUint(value);
-    findValue(instance()->m_domSettings, path)->value.SetUint(value);
+    if (auto node = instance()->m_nodesSettings[path.id()]; node != nullptr)
+    {
+        return readValue<T>(*node);
+    }
+    return readValue<T>(instance()->m_game.value(*instance()->m_nodesGame[path.id()]));
 }
 
-template <>
-void Configuration::set(const std::vector<std::string>& path, std::uint8_t value)
+template <typename T>
+T Configuration::get(const std::vector<std::string>& path)
 {
-    findValue(instance()->m_domFull, path)->value.SetUint(value);
-    findValue(instance()->m_domSettings, path)->value.SetUint(value);
+    if (auto node = findValue(instance()->m_domSettings, path); node != nullptr)
+    {
+        return readValue<T>(*node);
+    }
+    if (auto node = instance()->m_game.find(path); node != nullptr)
+    {
+        return readValue<T>(instance()->m_game.value(*node));
+    }
+
+    std::string name;
+    for (auto&& part : path)
+    {
+        name += (name.empty() ? "" : "/") + part;
+    }
+    std::cout << "configuration setting not found: " << name << std::endl;
+    instance()->m_missingSetting = true;
+    return T{};
 }
 
-template <>
-void Configuration::set(const std::vector<std::string>& path, bool value)
+// --------------------------------------------------------------
+//
+// Only the user settings can be changed, the changed values are what
+// is persisted by serialize.
+//
+// --------------------------------------------------------------
+template <typename T>
+void Configuration::set(config::Path path, T value)
 {
-    findValue(instance()->m_domFull, path)->value.SetBool(value);
-    findValue(instance()->m_domSettings, path)->value.SetBool(value);
+    auto node = instance()->m_nodesSettings[path.id()];
+    if (node == nullptr)
+    {
+        std::cout << "not a user setting, unable to change: " << config::FIXED_PATHS[path.id()] << std::endl;
+        return;
+    }
+    write<T>(*node, value, instance()->m_domSettings);
 }
 
-template <>
-void Configuration::set(const std::vector<std::string>& path, float value)
+template bool Configuration::get(config::Path);
+template std::string Configuration::get(config::Path);
+template std::uint8_t Configuration::get(config::Path);
+template std::uint16_t Configuration::get(config::Path);
+template std::uint32_t Configuration::get(config::Path);
+template int Configuration::get(config::Path);
+template float Configuration::get(config::Path);
+template double Configuration::get(config::Path);
+template std::chrono::milliseconds Configuration::get(config::Path);
+
+template bool Configuration::get(const std::vector<std::string>&);
+template std::string Configuration::get(const std::vector<std::string>&);
+template std::uint8_t Configuration::get(const std::vector<std::string>&);
+template std::uint16_t Configuration::get(const std::vector<std::string>&);
+template std::uint32_t Configuration::get(const std::vector<std::string>&);
+template int Configuration::get(const std::vector<std::string>&);
+template float Configuration::get(const std::vector<std::string>&);
+template double Configuration::get(const std::vector<std::string>&);
+template std::chrono::milliseconds Configuration::get(const std::vector<std::string>&);
+
+template void Configuration::set(config::Path, std::string);
+template void Configuration::set(config::Path, std::uint16_t);
+template void Configuration::set(config::Path, std::uint8_t);
+template void Configuration::set(config::Path, bool);
+template void Configuration::set(config::Path, float);
+
+// --------------------------------------------------------------
+//
+// Pulls the game-play settings out of the DOM, one time, into the
+// snapshot.  Weapons and levels are read in the order of their name
+// tables, so the snapshot can index them by WeaponName and LevelName.
+// Returns false if any of the settings weren't there.
+//
+// --------------------------------------------------------------
+bool Configuration::compileSnapshot()
 {
-    findValue(instance()->m_domFull, path)->value.SetDouble(value);
-    findValue(instance()->m_domSettings, path)->value.SetDouble(value);
+    using namespace config;
+
+    m_snapshot = {};
+    m_missingSetting = false;
+
+    auto& player = m_snapshot.player;
+    player.thrustRate = get<double>(PLAYER_THRUST_RATE);
+    player.dragRate = get<double>(PLAYER_DRAG_RATE);
+    player.rotateRate = get<float>(PLAYER_ROTATE_RATE);
+    player.maxSpeed = get<float>(PLAYER_MAX_SPEED);
+    player.size = get<float>(PLAYER_SIZE);
+
+    auto& virus = m_snapshot.virus;
+    virus.rotateRate = get<float>(VIRUS_ROTATE_RATE);
+    virus.speed = get<float>(VIRUS_SPEED);
+    virus.sizeMin = get<float>(VIRUS_SIZE_MIN);
+    virus.sizeMax = get<float>(VIRUS_SIZE_MAX);
+    virus.healthStart = get<std::uint16_t>(VIRUS_HEALTH_START);
+    virus.healthIncrements = get<std::uint8_t>(VIRUS_HEALTH_INCREMENTS);
+    virus.healthIncrementTime = get<std::chrono::milliseconds>(VIRUS_HEALTH_INCREMENT_TIME);
+    virus.ageMaturity = get<std::chrono::milliseconds>(VIRUS_AGE_MATURITY);
+    virus.gestationMin = get<std::chrono::milliseconds>(VIRUS_GEST_MIN);
+    virus.gestationMean = get<std::chrono::milliseconds>(VIRUS_GEST_MEAN);
+    virus.gestationStdev = get<std::chrono::milliseconds>(VIRUS_GEST_STDEV);
+
+    auto& bomb = m_snapshot.bomb;
+    bomb.bulletCount = get<std::uint16_t>({ DOM_ENTITY, ENTITY_WEAPON_BOMB, DOM_BULLETS, "count"s });
+    bomb.bulletDamage = get<std::uint16_t>({ DOM_ENTITY, ENTITY_WEAPON_BOMB, DOM_BULLETS, DOM_DAMAGE });
+    bomb.bulletSize = get<float>({ DOM_ENTITY, ENTITY_WEAPON_BOMB, DOM_BULLETS, DOM_SIZE });
+    bomb.bulletLifetime = get<std::chrono::milliseconds>({ DOM_ENTITY, ENTITY_WEAPON_BOMB, DOM_BULLETS, DOM_LIFETIME });
+
+    for (std::size_t i = 0; i < WEAPON_NAMES.size(); i++)
+    {
+        std::string key = WEAPON_NAMES[i];
+        auto& weapon = m_snapshot.weapons[i];
+        weapon.fireDelay = get<std::chrono::milliseconds>({ DOM_ENTITY, key, DOM_FIRE_DELAY });
+        weapon.damage = get<std::uint16_t>({ DOM_ENTITY, key, DOM_DAMAGE });
+        weapon.lifetime = get<std::chrono::milliseconds>({ DOM_ENTITY, key, DOM_LIFETIME });
+        weapon.size = get<float>({ DOM_ENTITY, key, DOM_SIZE });
+        if (has({ DOM_ENTITY, key, DOM_POWERUP }))
+        {
+            auto& powerup = m_snapshot.powerups[i];
+            powerup.size = get<float>({ DOM_ENTITY, key, DOM_POWERUP, DOM_SIZE });
+            powerup.lifetime = get<std::chrono::milliseconds>({ DOM_ENTITY, key, DOM_POWERUP, DOM_LIFETIME });
+            powerup.spriteCount = get<std::uint8_t>({ DOM_ENTITY, key, DOM_POWERUP, DOM_SPRITE_COUNT });
+            powerup.spriteTime = get<std::chrono::milliseconds>({ DOM_ENTITY, key, DOM_POWERUP, DOM_SPRITE_TIME });
+        }
+    }
+
+    for (std::size_t i = 0; i < LEVEL_NAMES.size(); i++)
+    {
+        std::string key = LEVEL_NAMES[i];
+        auto& level = m_snapshot.levels[i];
+        level.name = get<std::string>({ DOM_LEVELS, key, DOM_NAME });
+        level.backgroundImage = get<std::string>({ DOM_LEVELS, key, DOM_CONTENT, DOM_IMAGE, DOM_BACKGROUND });
+        level.backgroundMusic = get<std::string>({ DOM_LEVELS, key, DOM_CONTENT, DOM_MUSIC, DOM_BACKGROUND });
+        level.messageReady = get<std::string>({ DOM_LEVELS, key, DOM_CONTENT, DOM_MESSAGES, DOM_READY });
+        level.messageSuccess = get<std::string>({ DOM_LEVELS, key, DOM_CONTENT, DOM_MESSAGES, DOM_SUCCESS });
+        level.messageFailure = get<std::string>({ DOM_LEVELS, key, DOM_CONTENT, DOM_MESSAGES, DOM_FAILURE });
+        level.initialVirusCount = get<std::uint8_t>({ DOM_LEVELS, key, DOM_SETTINGS, DOM_INITIAL_VIRUS_COUNT });
+        level.maxVirusCount = get<std::uint8_t>({ DOM_LEVELS, key, DOM_SETTINGS, DOM_MAX_VIRUS_COUNT });
+        level.nanoBotCount = get<std::uint8_t>({ DOM_LEVELS, key, DOM_SETTINGS, DOM_NANO_BOT_COUNT });
+        level.minPowerupTime = get<std::chrono::milliseconds>({ DOM_LEVELS, key, DOM_SETTINGS, "min-powerup-time"s });
+        level.bombPowerupTime = get<std::chrono::milliseconds>({ DOM_LEVELS, key, DOM_SETTINGS, "bomb-powerup-time"s });
+        level.rapidFirePowerupTime = get<std::chrono::milliseconds>({ DOM_LEVELS, key, DOM_SETTINGS, "rapid-fire-powerup-time"s });
+        level.spreadFirePowerupTime = get<std::chrono::milliseconds>({ DOM_LEVELS, key, DOM_SETTINGS, "spread-fire-powerup-time"s });
+    }
+
+    return !m_missingSetting;
 }
 
 // --------------------------------------------------------------
@@ -236,3 +478,45 @@ void Configuration::Graphics::updateScale()
         m_uiScaled = true;
     }
 }
+
+// --------------------------------------------------------------
+//
+// Puts the view coordinates and scaling back to where they start out,
+// so they can be computed again for a new window.
+//
+// --------------------------------------------------------------
+void Configuration::Graphics::reset()
+{
+    Graphics initial;
+    m_uiScaled = initial.m_uiScaled;
+    m_scale = initial.m_scale;
+    m_scaleUI = initial.m_scaleUI;
+    m_viewCoordinates = initial.m_viewCoordinates;
+}
+
+std::uint32_t Configuration::Graphics::registerChangedHandler(ChangedHandler handler)
+{
+    auto id = m_nextHandlerId++;
+    m_handlersChanged[id] = handler;
+
+    return id;
+}
+
+void Configuration::Graphics::unregisterChangedHandler(std::uint32_t id)
+{
+    m_handlersChanged.erase(id);
+}
+
+// --------------------------------------------------------------
+//
+// Lets everyone that depends upon the graphics settings know they
+// have changed, so they can update whatever they computed from them.
+//
+// --------------------------------------------------------------
+void Configuration::Graphics::signalChanged()
+{
+    for (auto&& [id, handler] : m_handlersChanged)
+    {
+        handler();
+    }
+}
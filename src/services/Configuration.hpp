@@ -23,9 +23,16 @@ THE SOFTWARE.
 #pragma once
 
 #include "misc/math.hpp"
+#include "services/ConfigurationBlob.hpp"
+#include "services/ConfigurationPath.hpp"
+#include "services/ConfigurationSnapshot.hpp"
 
+#include <array>
+#include <cstdint>
+#include <functional>
 #include <rapidjson/document.h>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 // --------------------------------------------------------------
@@ -54,24 +61,30 @@ class Configuration
 
     bool initialize(const std::string_view jsonSettings, const std::string_view jsonDeveloper);
     std::string serialize();
-    void reset()
-    {
-        delete m_instance;
-        m_instance = nullptr;
-    } // Believe me, I know, a terrible thing to do!
 
+    template <typename T>
+    static T get(config::Path path);
     template <typename T>
     static T get(const std::vector<std::string>& path);
 
     template <typename T>
-    static void set(const std::vector<std::string>& path, T value);
+    static void set(config::Path path, T value);
+
+    static bool has(const std::vector<std::string>& path);
+    static std::vector<std::string> getMembers(const std::vector<std::string>& path);
 
     //
     // Additional Graphics configuration settings
     //
+    // Anything that computes its layout from these (view coordinates, scale)
+    // registers a changed handler, which is signaled once the window has
+    // been recreated with new graphics options.
+    //
     class Graphics
     {
       public:
+        using ChangedHandler = std::function<void()>;
+
         auto getScale() { return m_scale; }     // Gameplay may or may not scale to the resolution, depends on configuraton
         auto getScaleUI() { return m_scaleUI; } // UI always scales to the resolution
         auto getViewCoordinates() { return m_viewCoordinates; }
@@ -90,6 +103,11 @@ class Configuration
         {
             m_restart = state;
         }
+        void reset();
+
+        std::uint32_t registerChangedHandler(ChangedHandler handler);
+        void unregisterChangedHandler(std::uint32_t id);
+        void signalChanged();
 
       private:
         friend Configuration;
@@ -102,18 +120,36 @@ class Configuration
         unsigned int m_bpp{ 24 };
         bool m_restart{ false }; // Set to true when the window should be restarted due to a change in the graphics options
 
+        std::uint32_t m_nextHandlerId{ 0 };
+        std::unordered_map<std::uint32_t, ChangedHandler> m_handlersChanged;
+
         void updateScale();
     };
 
     static Graphics& getGraphics() { return instance()->m_graphics; }
 
+    // Game-play settings, compiled from the configuration by initialize
+    static const config::Snapshot& getSnapshot() { return instance()->m_snapshot; }
+
   private:
     Configuration() {}
 
-    rapidjson::Document m_domFull;
     rapidjson::Document m_domSettings;
+    ConfigurationBlob m_game;
+    std::vector<std::uint8_t> m_gameCompiled; // Only used when the game configuration comes from the developer json
+    // The nodes for the fixed paths, indexed by their id; nullptr if the setting isn't in that one
+    std::array<rapidjson::Value*, config::FIXED_PATH_COUNT> m_nodesSettings{};
+    std::array<const ConfigurationBlob::Node*, config::FIXED_PATH_COUNT> m_nodesGame{};
 
     Graphics m_graphics;
+    config::Snapshot m_snapshot;
+    bool m_missingSetting{ false }; // Set when get is asked for a runtime path that isn't there
+
+    bool resolvePaths();
+    bool compileSnapshot();
+
+    template <typename T>
+    static void write(rapidjson::Value& node, T value, rapidjson::Document& dom);
 
     static Configuration* m_instance;
 };
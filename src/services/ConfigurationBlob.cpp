@@ -0,0 +1,185 @@
+/*
+Copyright (c) 2021 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "services/ConfigurationBlob.hpp"
+
+#include <cstring>
+#include <iostream>
+#include <utility>
+
+// --------------------------------------------------------------
+//
+// Flattens the DOM into the blob.  The nodes are laid out breadth
+// first, so the members of each object end up next to each other.
+//
+// --------------------------------------------------------------
+std::vector<std::uint8_t> ConfigurationBlob::compile(const rapidjson::Value& root)
+{
+    std::vector<Node> nodes;
+    std::string strings;
+    auto addString = [&strings](const char* s, std::size_t length)
+    {
+        auto offset = static_cast<std::uint32_t>(strings.size());
+        strings.append(s, length);
+        strings.push_back('\0');
+        return offset;
+    };
+
+    // Each entry is a DOM value and the node it becomes
+    std::vector<std::pair<const rapidjson::Value*, std::size_t>> pending{ { &root, 0 } };
+    nodes.push_back({});
+    for (std::size_t next = 0; next < pending.size(); next++)
+    {
+        auto [value, index] = pending[next];
+        Node node = nodes[index];
+        if (value->IsObject())
+        {
+            node.type = Type::Object;
+            node.first = static_cast<std::uint32_t>(nodes.size());
+            node.count = static_cast<std::uint32_t>(value->MemberCount());
+            for (auto member = value->MemberBegin(); member != value->MemberEnd(); member++)
+            {
+                Node child{};
+                child.name = addString(member->name.GetString(), member->name.GetStringLength());
+                pending.push_back({ &member->value, nodes.size() });
+                nodes.push_back(child);
+            }
+        }
+        else if (value->IsString())
+        {
+            node.type = Type::String;
+            node.first = addString(value->GetString(), value->GetStringLength());
+        }
+        else if (value->IsNumber())
+        {
+            node.type = Type::Number;
+            node.number = value->GetDouble();
+        }
+        else if (value->IsBool())
+        {
+            node.type = Type::Bool;
+            node.number = value->GetBool() ? 1.0 : 0.0;
+        }
+        else if (!value->IsNull())
+        {
+            std::cout << "configuration blob doesn't support arrays, skipped: " << strings.c_str() + node.name << std::endl;
+        }
+        nodes[index] = node;
+    }
+
+    Header header{};
+    std::memcpy(header.magic, MAGIC, sizeof(header.magic));
+    header.version = VERSION;
+    header.nodeCount = static_cast<std::uint32_t>(nodes.size());
+    header.stringsSize = static_cast<std::uint32_t>(strings.size());
+
+    std::vector<std::uint8_t> blob(sizeof(Header) + nodes.size() * sizeof(Node) + strings.size());
+    std::memcpy(blob.data(), &header, sizeof(Header));
+    std::memcpy(blob.data() + sizeof(Header), nodes.data(), nodes.size() * sizeof(Node));
+    std::memcpy(blob.data() + sizeof(Header) + nodes.size() * sizeof(Node), strings.data(), strings.size());
+
+    return blob;
+}
+
+// --------------------------------------------------------------
+//
+// Validates the header and points into the data, which has to stay
+// alive, and 8 byte aligned, for as long as the blob is used.  If
+// anything doesn't look right the blob is left closed.
+//
+// --------------------------------------------------------------
+bool ConfigurationBlob::open(const void* data, std::size_t size)
+{
+    m_nodes = nullptr;
+    m_nodeCount = 0;
+    m_strings = nullptr;
+
+    auto bytes = static_cast<const std::uint8_t*>(data);
+    if (size < sizeof(Header))
+    {
+        return false;
+    }
+    Header header;
+    std::memcpy(&header, bytes, sizeof(Header));
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION || header.nodeCount == 0)
+    {
+        return false;
+    }
+    auto stringsStart = sizeof(Header) + static_cast<std::uint64_t>(header.nodeCount) * sizeof(Node);
+    if (stringsStart + header.stringsSize != size || (header.stringsSize > 0 && bytes[size - 1] != '\0'))
+    {
+        return false;
+    }
+
+    m_nodes = reinterpret_cast<const Node*>(bytes + sizeof(Header));
+    m_nodeCount = header.nodeCount;
+    m_strings = reinterpret_cast<const char*>(bytes + stringsStart);
+
+    return true;
+}
+
+// --------------------------------------------------------------
+//
+// Returns the node at the path, or nullptr if there isn't one.
+//
+// --------------------------------------------------------------
+const ConfigurationBlob::Node* ConfigurationBlob::find(const std::vector<std::string>& path) const
+{
+    const Node* node = m_nodes;
+    for (auto itr = path.begin(); node != nullptr && itr != path.end(); itr++)
+    {
+        node = findMember(*node, itr->c_str());
+    }
+
+    return node;
+}
+
+std::vector<std::string> ConfigurationBlob::getMembers(const Node& node) const
+{
+    std::vector<std::string> names;
+    if (node.type == Type::Object)
+    {
+        for (auto member = m_nodes + node.first; member != m_nodes + node.first + node.count; member++)
+        {
+            names.push_back(string(member->name));
+        }
+    }
+
+    return names;
+}
+
+const ConfigurationBlob::Node* ConfigurationBlob::findMember(const Node& node, const char* name) const
+{
+    if (node.type != Type::Object || node.first + node.count > m_nodeCount)
+    {
+        return nullptr;
+    }
+    for (auto member = m_nodes + node.first; member != m_nodes + node.first + node.count; member++)
+    {
+        if (std::strcmp(string(member->name), name) == 0)
+        {
+            return member;
+        }
+    }
+
+    return nullptr;
+}
@@ -0,0 +1,122 @@
+/*
+Copyright (c) 2021 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <rapidjson/document.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// --------------------------------------------------------------
+//
+// Read-only view of the game configuration compiled ahead of time by
+// the CompileConfiguration tool.  Nothing is parsed when it is opened,
+// the nodes are used right where they are.
+//
+// Layout of the blob:
+//   Header
+//   Node[nodeCount], node 0 is the root object
+//   strings, each one null terminated
+//
+// The members of an object are contiguous nodes, in the same order
+// they appear in the JSON.
+//
+// --------------------------------------------------------------
+class ConfigurationBlob
+{
+  public:
+    static constexpr char MAGIC[8]{ 'N', 'A', 'N', 'O', 'C', 'F', 'G', '\0' };
+    static constexpr std::uint32_t VERSION{ 1 };
+
+    enum class Type : std::uint32_t
+    {
+        Null,
+        Bool,
+        Number,
+        String,
+        Object
+    };
+
+    struct Header
+    {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t nodeCount;
+        std::uint32_t stringsSize;
+        std::uint32_t reserved;
+    };
+
+    struct Node
+    {
+        std::uint32_t name;  // Offset into the strings, for the members of an object
+        Type type;
+        std::uint32_t first; // Object: index of the first member, String: offset into the strings
+        std::uint32_t count; // Object: number of members
+        double number;       // Number, or Bool as 0/1
+    };
+
+    // --------------------------------------------------------------
+    //
+    // A node together with the blob it belongs to, with the same
+    // accessors as a rapidjson value so reading a setting doesn't care
+    // which one it came from.
+    //
+    // --------------------------------------------------------------
+    class Value
+    {
+      public:
+        Value(const ConfigurationBlob& blob, const Node& node) :
+            m_blob(blob),
+            m_node(node)
+        {
+        }
+
+        bool GetBool() const { return m_node.number != 0; }
+        const char* GetString() const { return m_blob.string(m_node.first); }
+        unsigned GetUint() const { return static_cast<unsigned>(m_node.number); }
+        int GetInt() const { return static_cast<int>(m_node.number); }
+        double GetDouble() const { return m_node.number; }
+
+      private:
+        const ConfigurationBlob& m_blob;
+        const Node& m_node;
+    };
+
+    static std::vector<std::uint8_t> compile(const rapidjson::Value& root);
+
+    bool open(const void* data, std::size_t size);
+    bool isOpen() const { return m_nodes != nullptr; }
+
+    const Node* find(const std::vector<std::string>& path) const;
+    std::vector<std::string> getMembers(const Node& node) const;
+    Value value(const Node& node) const { return Value(*this, node); }
+
+  private:
+    const Node* m_nodes{ nullptr };
+    std::uint32_t m_nodeCount{ 0 };
+    const char* m_strings{ nullptr };
+
+    const char* string(std::uint32_t offset) const { return m_strings + offset; }
+    const Node* findMember(const Node& node, const char* name) const;
+};
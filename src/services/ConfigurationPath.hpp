@@ -22,240 +22,406 @@ THE SOFTWARE.
 
 #pragma once
 
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace config
 {
     using namespace std::string_literals;
+
+    // Built at runtime, for the parts of the configuration whose names aren't known until then
     using config_path = std::vector<std::string>;
+
+    // --------------------------------------------------------------
+    //
+    // The settings the code refers to by name are identified by a Path,
+    // its id is the position of the setting in FIXED_PATHS, fixed at
+    // compile time.  When the configuration is read, each of these is
+    // resolved to its node in the DOM one time, after that get and set
+    // index straight to the node instead of walking the DOM comparing
+    // names.  A misspelled path fails to compile.
+    //
+    // --------------------------------------------------------------
+    class Path
+    {
+      public:
+        constexpr explicit Path(std::uint16_t id) :
+            m_id(id)
+        {
+        }
+
+        constexpr std::uint16_t id() const { return m_id; }
+
+      private:
+        std::uint16_t m_id;
+    };
+
+    constexpr std::string_view FIXED_PATHS[] = {
+        "developer/main-menu",
+
+        "graphics/resolution/width",
+        "graphics/resolution/height",
+        "graphics/bpp",
+        "graphics/full-screen",
+        "graphics/vsync",
+        "graphics/scale-to-resolution",
+
+        "keyboard/up",
+        "keyboard/down",
+        "keyboard/left",
+        "keyboard/right",
+        "keyboard/primary-fire",
+        "keyboard/secondary-fire",
+
+        "music/play-background",
+
+        "content/memory-budget",
+        "content/font/title/filename",
+        "content/font/title/size",
+        "content/font/menu/filename",
+        "content/font/menu/size",
+        "content/font/credits/filename",
+        "content/font/credits/title-size",
+        "content/font/credits/item-size",
+        "content/font/game-status/filename",
+        "content/font/game-status/size",
+        "content/font/settings/filename",
+        "content/font/settings/item-size",
+        "content/font/settings/message-size",
+        "content/font/level-select/filename",
+        "content/font/level-select/item-size",
+        "content/font/level-select/title-size",
+        "content/font/gameplay/filename",
+        "content/font/gameplay/score-size",
+        "content/audio/menu/activate",
+        "content/audio/menu/accept",
+        "content/audio/coalesce-window",
+        "content/audio/coalesce-volume",
+        "content/image/menu-background",
+
+        "entity/player/thrust-rate",
+        "entity/player/drag-rate",
+        "entity/player/rotate-rate",
+        "entity/player/size",
+        "entity/player/max-speed",
+        "entity/player/image/ship",
+        "entity/player/image/destroy-particle",
+        "entity/player/image/start-particle",
+        "entity/player/audio/thrust",
+        "entity/player/audio/death",
+        "entity/player/audio/start",
+
+        "entity/sars-cov2/image/virus",
+        "entity/sars-cov2/image/particle",
+        "entity/sars-cov2/audio/death",
+        "entity/sars-cov2/rotate-rate",
+        "entity/sars-cov2/speed",
+        "entity/sars-cov2/size/min",
+        "entity/sars-cov2/size/max",
+        "entity/sars-cov2/health/start",
+        "entity/sars-cov2/health/increments",
+        "entity/sars-cov2/health/increment-time",
+        "entity/sars-cov2/age-maturity",
+        "entity/sars-cov2/gestation/min",
+        "entity/sars-cov2/gestation/mean",
+        "entity/sars-cov2/gestation/stdev",
+
+        "entity/basic-gun/image/bullet",
+        "entity/bomb/image/bullet",
+        "entity/basic-gun/audio/fire",
+        "entity/bomb/audio/fire",
+        "entity/bomb/audio/explode",
+
+        "entity/rapid-fire/powerup/image",
+        "entity/rapid-fire/powerup/audio",
+        "entity/spread-fire/powerup/image",
+        "entity/spread-fire/powerup/audio",
+        "entity/bomb/powerup/image",
+        "entity/bomb/powerup/audio",
+
+        "levels/training-1/name",
+        "levels/training-2/name",
+        "levels/training-3/name",
+        "levels/training-4/name",
+        "levels/training-5/name",
+        "levels/patient-1/name",
+        "levels/patient-2/name",
+        "levels/patient-3/name",
+    };
+
+    constexpr std::size_t FIXED_PATH_COUNT = std::size(FIXED_PATHS);
+
+    // Only ever evaluated at compile time, an unknown path fails to compile
+    constexpr Path fixed(std::string_view path)
+    {
+        for (std::uint16_t id = 0; id < FIXED_PATH_COUNT; id++)
+        {
+            if (FIXED_PATHS[id] == path)
+            {
+                return Path(id);
+            }
+        }
+        throw std::logic_error("not one of the fixed configuration paths");
+    }
+
     // --------------------------------------------------------------
     //
     // Commonly used settings names
     //
     // --------------------------------------------------------------
-    const auto DOM_FILENAME = "filename"s;
-    const auto DOM_ENTITY = "entity"s;
-    const auto DOM_COMPONENT = "component"s;
-    const auto DOM_SIZE = "size"s;
-    const auto DOM_MIN = "min"s;
-    const auto DOM_MAX = "max"s;
-    const auto DOM_MEAN = "mean"s;
-    const auto DOM_STDEV = "stdev"s;
-    const auto DOM_HEALTH = "health";
-    const auto DOM_ROTATE_RATE = "rotate-rate"s;
-    const auto DOM_IMAGE = "image"s;
-    const auto DOM_AUDIO = "audio"s;
-    const auto DOM_PARTICLE = "particle"s;
-    const auto DOM_BACKGROUND = "background"s;
-    const auto DOM_SETTINGS = "settings"s;
-    const auto DOM_LEVEL_SELECT = "level-select"s;
-    const auto DOM_DAMAGE = "damage"s;
-    const auto DOM_FIRE_DELAY = "fire-delay"s;
-    const auto DOM_LIFETIME = "lifetime"s;
-    const auto DOM_FIRE = "fire"s;
-    const auto DOM_BULLET = "bullet"s;
-    const auto DOM_GESTATION = "gestation"s;
-    const auto DOM_POWERUP = "powerup"s;
-    const auto DOM_SPRITE_COUNT = "sprite-count"s;
-    const auto DOM_SPRITE_TIME = "sprite-time"s;
-    const auto DOM_BOMB = "bomb"s;
-    const auto DOM_EXPLODE = "explode"s;
-    const auto DOM_BULLETS = "bullets"s;
-    const auto DOM_INITIAL_VIRUS_COUNT = "initial-virus-count"s;
-    const auto DOM_MAX_VIRUS_COUNT = "max-virus-count"s;
-    const auto DOM_NANO_BOT_COUNT = "nano-bot-count";
-    const auto DOM_READY = "ready"s;
-    const auto DOM_SUCCESS = "success"s;
-    const auto DOM_FAILURE = "failure"s;
-    const auto DOM_MESSAGES = "messages"s;
-    const auto DOM_NAME = "name"s;
+    constexpr auto DOM_FILENAME = "filename";
+    constexpr auto DOM_ENTITY = "entity";
+    constexpr auto DOM_COMPONENT = "component";
+    constexpr auto DOM_SIZE = "size";
+    constexpr auto DOM_MIN = "min";
+    constexpr auto DOM_MAX = "max";
+    constexpr auto DOM_MEAN = "mean";
+    constexpr auto DOM_STDEV = "stdev";
+    constexpr auto DOM_HEALTH = "health";
+    constexpr auto DOM_ROTATE_RATE = "rotate-rate";
+    constexpr auto DOM_IMAGE = "image";
+    constexpr auto DOM_AUDIO = "audio";
+    constexpr auto DOM_PARTICLE = "particle";
+    constexpr auto DOM_BACKGROUND = "background";
+    constexpr auto DOM_SETTINGS = "settings";
+    constexpr auto DOM_LEVEL_SELECT = "level-select";
+    constexpr auto DOM_DAMAGE = "damage";
+    constexpr auto DOM_FIRE_DELAY = "fire-delay";
+    constexpr auto DOM_LIFETIME = "lifetime";
+    constexpr auto DOM_FIRE = "fire";
+    constexpr auto DOM_BULLET = "bullet";
+    constexpr auto DOM_GESTATION = "gestation";
+    constexpr auto DOM_POWERUP = "powerup";
+    constexpr auto DOM_SPRITE_COUNT = "sprite-count";
+    constexpr auto DOM_SPRITE_TIME = "sprite-time";
+    constexpr auto DOM_BOMB = "bomb";
+    constexpr auto DOM_EXPLODE = "explode";
+    constexpr auto DOM_BULLETS = "bullets";
+    constexpr auto DOM_INITIAL_VIRUS_COUNT = "initial-virus-count";
+    constexpr auto DOM_MAX_VIRUS_COUNT = "max-virus-count";
+    constexpr auto DOM_NANO_BOT_COUNT = "nano-bot-count";
+    constexpr auto DOM_READY = "ready";
+    constexpr auto DOM_SUCCESS = "success";
+    constexpr auto DOM_FAILURE = "failure";
+    constexpr auto DOM_MESSAGES = "messages";
+    constexpr auto DOM_NAME = "name";
 
     // --------------------------------------------------------------
     //
     // Developer configuration names
     //
     // --------------------------------------------------------------
-    const auto DOM_DEVELOPER = "developer"s;
-    const config_path DEVELOPER_MAIN_MENU = { DOM_DEVELOPER, "main-menu"s }; // true if main menu do be displayed, otherwise directly join game
+    constexpr auto DOM_DEVELOPER = "developer";
+    constexpr Path DEVELOPER_MAIN_MENU = fixed("developer/main-menu"); // true if main menu do be displayed, otherwise directly join game
 
     // --------------------------------------------------------------
     //
     // Graphics configuration names
     //
     // --------------------------------------------------------------
-    const auto DOM_GRAPHICS = "graphics"s;
-    const auto DOM_GRAPHICS_RESOLUTION = "resolution"s;
-    const config_path GRAPHICS_WIDTH = { DOM_GRAPHICS, DOM_GRAPHICS_RESOLUTION, "width"s };
-    const config_path GRAPHICS_HEIGHT = { DOM_GRAPHICS, DOM_GRAPHICS_RESOLUTION, "height"s };
-    const config_path GRAPHICS_BPP = { DOM_GRAPHICS, "bpp"s };                                 // bits per pixel
-    const config_path GRAPHICS_FULL_SCREEN = { DOM_GRAPHICS, "full-screen"s };                 // true if it should run full screen
-    const config_path GRAPHICS_VSYNC = { DOM_GRAPHICS, "vsync"s };                             // true if v-sync should be on
-    const config_path GRAPHICS_SCALE_TO_RESOLUTION = { DOM_GRAPHICS, "scale-to-resolution"s }; // True if graphics grow/shink with resolution
+    constexpr auto DOM_GRAPHICS = "graphics";
+    constexpr auto DOM_GRAPHICS_RESOLUTION = "resolution";
+    constexpr Path GRAPHICS_WIDTH = fixed("graphics/resolution/width");
+    constexpr Path GRAPHICS_HEIGHT = fixed("graphics/resolution/height");
+    constexpr Path GRAPHICS_BPP = fixed("graphics/bpp");                                 // bits per pixel
+    constexpr Path GRAPHICS_FULL_SCREEN = fixed("graphics/full-screen");                 // true if it should run full screen
+    constexpr Path GRAPHICS_VSYNC = fixed("graphics/vsync");                             // true if v-sync should be on
+    constexpr Path GRAPHICS_SCALE_TO_RESOLUTION = fixed("graphics/scale-to-resolution"); // True if graphics grow/shink with resolution
 
     // --------------------------------------------------------------
     //
     // Keyboard control configuration names
     //
     // --------------------------------------------------------------
-    const auto DOM_KEYBOARD = "keyboard"s;
-    const config_path KEYBOARD_UP = { DOM_KEYBOARD, "up"s };
-    const config_path KEYBOARD_DOWN = { DOM_KEYBOARD, "down"s };
-    const config_path KEYBOARD_LEFT = { DOM_KEYBOARD, "left"s };
-    const config_path KEYBOARD_RIGHT = { DOM_KEYBOARD, "right"s };
-    const config_path KEYBOARD_PRIMARY_FIRE = { DOM_KEYBOARD, "primary-fire"s };
-    const config_path KEYBOARD_SECONDARY_FIRE = { DOM_KEYBOARD, "secondary-fire"s };
+    constexpr auto DOM_KEYBOARD = "keyboard";
+    constexpr Path KEYBOARD_UP = fixed("keyboard/up");
+    constexpr Path KEYBOARD_DOWN = fixed("keyboard/down");
+    constexpr Path KEYBOARD_LEFT = fixed("keyboard/left");
+    constexpr Path KEYBOARD_RIGHT = fixed("keyboard/right");
+    constexpr Path KEYBOARD_PRIMARY_FIRE = fixed("keyboard/primary-fire");
+    constexpr Path KEYBOARD_SECONDARY_FIRE = fixed("keyboard/secondary-fire");
 
     // --------------------------------------------------------------
     //
     // Music configuration names
     //
     // --------------------------------------------------------------
-    const auto DOM_MUSIC = "music";
-    const config_path PLAY_BACKGROUND_MUSIC = { DOM_MUSIC, "play-background" };
+    constexpr auto DOM_MUSIC = "music";
+    constexpr Path PLAY_BACKGROUND_MUSIC = fixed("music/play-background");
 
     // --------------------------------------------------------------
     //
     // Content configuration names
     //
     // --------------------------------------------------------------
-    const auto DOM_CONTENT = "content"s;
-    const auto DOM_FONT = "font"s;
-    const auto DOM_TITLE = "title"s;
-    const auto DOM_MENU = "menu"s;
-    const auto DOM_CREDITS = "credits"s;
-    const auto DOM_GAMEPLAY = "gameplay"s;
-    const auto DOM_GAME_STATUS = "game-status"s;
-    const auto DOM_ITEM_SIZE = "item-size"s;
-    const auto DOM_TITLE_SIZE = "title-size"s;
+    constexpr auto DOM_CONTENT = "content";
+    constexpr auto DOM_FONT = "font";
+    constexpr auto DOM_TITLE = "title";
+    constexpr auto DOM_MENU = "menu";
+    constexpr auto DOM_CREDITS = "credits";
+    constexpr auto DOM_GAMEPLAY = "gameplay";
+    constexpr auto DOM_GAME_STATUS = "game-status";
+    constexpr auto DOM_ITEM_SIZE = "item-size";
+    constexpr auto DOM_TITLE_SIZE = "title-size";
 
-    const config_path FONT_TITLE_FILENAME = { DOM_CONTENT, DOM_FONT, DOM_TITLE, DOM_FILENAME };
-    const config_path FONT_TITLE_SIZE = { DOM_CONTENT, DOM_FONT, DOM_TITLE, DOM_SIZE };
-    const config_path FONT_MENU_FILENAME = { DOM_CONTENT, DOM_FONT, DOM_MENU, DOM_FILENAME };
-    const config_path FONT_MENU_SIZE = { DOM_CONTENT, DOM_FONT, DOM_MENU, DOM_SIZE };
+    constexpr Path CONTENT_MEMORY_BUDGET = fixed("content/memory-budget"); // Megabytes of content kept resident before evicting
 
-    const config_path FONT_CREDITS_FILENAME = { DOM_CONTENT, DOM_FONT, DOM_CREDITS, DOM_FILENAME };
-    const config_path FONT_CREDITS_TITLE_SIZE = { DOM_CONTENT, DOM_FONT, DOM_CREDITS, DOM_TITLE_SIZE };
-    const config_path FONT_CREDITS_ITEM_SIZE = { DOM_CONTENT, DOM_FONT, DOM_CREDITS, DOM_ITEM_SIZE };
+    constexpr Path FONT_TITLE_FILENAME = fixed("content/font/title/filename");
+    constexpr Path FONT_TITLE_SIZE = fixed("content/font/title/size");
+    constexpr Path FONT_MENU_FILENAME = fixed("content/font/menu/filename");
+    constexpr Path FONT_MENU_SIZE = fixed("content/font/menu/size");
 
-    const config_path FONT_GAME_STATUS_FILENAME = { DOM_CONTENT, DOM_FONT, DOM_GAME_STATUS, DOM_FILENAME };
-    const config_path FONT_GAME_STATUS_SIZE = { DOM_CONTENT, DOM_FONT, DOM_GAME_STATUS, DOM_SIZE };
+    constexpr Path FONT_CREDITS_FILENAME = fixed("content/font/credits/filename");
+    constexpr Path FONT_CREDITS_TITLE_SIZE = fixed("content/font/credits/title-size");
+    constexpr Path FONT_CREDITS_ITEM_SIZE = fixed("content/font/credits/item-size");
 
-    const config_path FONT_SETTINGS_FILENAME = { DOM_CONTENT, DOM_FONT, DOM_SETTINGS, DOM_FILENAME };
-    const config_path FONT_SETTINGS_ITEM_SIZE = { DOM_CONTENT, DOM_FONT, DOM_SETTINGS, DOM_ITEM_SIZE };
-    const config_path FONT_SETTINGS_MESSAGE_SIZE = { DOM_CONTENT, DOM_FONT, DOM_SETTINGS, "message-size"s };
+    constexpr Path FONT_GAME_STATUS_FILENAME = fixed("content/font/game-status/filename");
+    constexpr Path FONT_GAME_STATUS_SIZE = fixed("content/font/game-status/size");
 
-    const config_path FONT_LEVEL_SELECT_FILENAME = { DOM_CONTENT, DOM_FONT, DOM_LEVEL_SELECT, DOM_FILENAME };
-    const config_path FONT_LEVEL_SELECT_ITEM_SIZE = { DOM_CONTENT, DOM_FONT, DOM_LEVEL_SELECT, DOM_ITEM_SIZE };
-    const config_path FONT_LEVEL_SELECT_TITLE_SIZE = { DOM_CONTENT, DOM_FONT, DOM_LEVEL_SELECT, DOM_TITLE_SIZE };
+    constexpr Path FONT_SETTINGS_FILENAME = fixed("content/font/settings/filename");
+    constexpr Path FONT_SETTINGS_ITEM_SIZE = fixed("content/font/settings/item-size");
+    constexpr Path FONT_SETTINGS_MESSAGE_SIZE = fixed("content/font/settings/message-size");
 
-    const config_path FONT_GAMEPLAY_FILENAME = { DOM_CONTENT, DOM_FONT, DOM_GAMEPLAY, DOM_FILENAME };
-    const config_path FONT_GAMEPLAY_SCORE_SIZE = { DOM_CONTENT, DOM_FONT, DOM_GAMEPLAY, "score-size"s };
+    constexpr Path FONT_LEVEL_SELECT_FILENAME = fixed("content/font/level-select/filename");
+    constexpr Path FONT_LEVEL_SELECT_ITEM_SIZE = fixed("content/font/level-select/item-size");
+    constexpr Path FONT_LEVEL_SELECT_TITLE_SIZE = fixed("content/font/level-select/title-size");
 
-    const config_path AUDIO_MENU_ACTIVATE = { DOM_CONTENT, DOM_AUDIO, DOM_MENU, "activate"s };
-    const config_path AUDIO_MENU_ACCEPT = { DOM_CONTENT, DOM_AUDIO, DOM_MENU, "accept"s };
+    constexpr Path FONT_GAMEPLAY_FILENAME = fixed("content/font/gameplay/filename");
+    constexpr Path FONT_GAMEPLAY_SCORE_SIZE = fixed("content/font/gameplay/score-size");
 
-    const config_path IMAGE_MENU_BACKGROUND = { DOM_CONTENT, DOM_IMAGE, "menu-background"s };
+    constexpr Path AUDIO_MENU_ACTIVATE = fixed("content/audio/menu/activate");
+    constexpr Path AUDIO_MENU_ACCEPT = fixed("content/audio/menu/accept");
+    constexpr Path AUDIO_COALESCE_WINDOW = fixed("content/audio/coalesce-window"); // Milliseconds within which requests for the same sound are merged
+    constexpr Path AUDIO_COALESCE_VOLUME = fixed("content/audio/coalesce-volume"); // Percent, what merged requests start from before being raised for their count
+
+    constexpr Path IMAGE_MENU_BACKGROUND = fixed("content/image/menu-background");
 
     // --------------------------------------------------------------
     //
     // Entity names
     //
     // --------------------------------------------------------------
-    const auto ENTITY_PLAYER = "player"s;
-    const auto ENTITY_SARSCOV2 = "sars-cov2"s;
-    const auto ENTITY_WEAPON_BASIC_GUN = "basic-gun"s;
-    const auto ENTITY_WEAPON_RAPID_FIRE = "rapid-fire"s;
-    const auto ENTITY_WEAPON_SPREAD_FIRE = "spread-fire"s;
-    const auto ENTITY_WEAPON_BOMB = "bomb"s;
+    constexpr auto ENTITY_PLAYER = "player";
+    constexpr auto ENTITY_SARSCOV2 = "sars-cov2";
+    constexpr auto ENTITY_WEAPON_BASIC_GUN = "basic-gun";
+    constexpr auto ENTITY_WEAPON_RAPID_FIRE = "rapid-fire";
+    constexpr auto ENTITY_WEAPON_SPREAD_FIRE = "spread-fire";
+    constexpr auto ENTITY_WEAPON_BOMB = "bomb";
 
     // --------------------------------------------------------------
     //
     // Entity: player attributes
     //
     // --------------------------------------------------------------
-    const config_path PLAYER_THRUST_RATE = { DOM_ENTITY, ENTITY_PLAYER, "thrust-rate" };
-    const config_path PLAYER_DRAG_RATE = { DOM_ENTITY, ENTITY_PLAYER, "drag-rate" };
-    const config_path PLAYER_ROTATE_RATE = { DOM_ENTITY, ENTITY_PLAYER, DOM_ROTATE_RATE };
-    const config_path PLAYER_SIZE = { DOM_ENTITY, ENTITY_PLAYER, DOM_SIZE };
-    const config_path PLAYER_MAX_SPEED = { DOM_ENTITY, ENTITY_PLAYER, "max-speed" };
-    const config_path PLAYER_IMAGE = { DOM_ENTITY, ENTITY_PLAYER, DOM_IMAGE, "ship"s };
-    const config_path PLAYER_PARTICLE = { DOM_ENTITY, ENTITY_PLAYER, DOM_IMAGE, "destroy-particle"s };
-    const config_path PLAYER_START_PARTICLE = { DOM_ENTITY, ENTITY_PLAYER, DOM_IMAGE, "start-particle"s };
-    const config_path PLAYER_AUDIO_THRUST = { DOM_ENTITY, ENTITY_PLAYER, DOM_AUDIO, "thrust"s };
-    const config_path PLAYER_AUDIO_DEATH = { DOM_ENTITY, ENTITY_PLAYER, DOM_AUDIO, "death"s };
-    const config_path PLAYER_AUDIO_START = { DOM_ENTITY, ENTITY_PLAYER, DOM_AUDIO, "start"s };
+    constexpr Path PLAYER_THRUST_RATE = fixed("entity/player/thrust-rate");
+    constexpr Path PLAYER_DRAG_RATE = fixed("entity/player/drag-rate");
+    constexpr Path PLAYER_ROTATE_RATE = fixed("entity/player/rotate-rate");
+    constexpr Path PLAYER_SIZE = fixed("entity/player/size");
+    constexpr Path PLAYER_MAX_SPEED = fixed("entity/player/max-speed");
+    constexpr Path PLAYER_IMAGE = fixed("entity/player/image/ship");
+    constexpr Path PLAYER_PARTICLE = fixed("entity/player/image/destroy-particle");
+    constexpr Path PLAYER_START_PARTICLE = fixed("entity/player/image/start-particle");
+    constexpr Path PLAYER_AUDIO_THRUST = fixed("entity/player/audio/thrust");
+    constexpr Path PLAYER_AUDIO_DEATH = fixed("entity/player/audio/death");
+    constexpr Path PLAYER_AUDIO_START = fixed("entity/player/audio/start");
 
     // --------------------------------------------------------------
     //
     // Entity: sars-cov2 attributes (some of them)
     //
     // --------------------------------------------------------------
-    const config_path VIRUS_IMAGE = { DOM_ENTITY, ENTITY_SARSCOV2, DOM_IMAGE, "virus"s };
-    const config_path VIRUS_PARTICLE = { DOM_ENTITY, ENTITY_SARSCOV2, DOM_IMAGE, "particle"s };
-    const config_path AUDIO_DEATH = { DOM_ENTITY, ENTITY_SARSCOV2, DOM_AUDIO, "death"s };
-
-    const config_path VIRUS_ROTATE_RATE = { DOM_ENTITY, ENTITY_SARSCOV2, DOM_ROTATE_RATE };
-    const config_path VIRUS_SPEED = { DOM_ENTITY, ENTITY_SARSCOV2, "speed" };
-    const config_path VIRUS_SIZE_MIN = { DOM_ENTITY, ENTITY_SARSCOV2, DOM_SIZE, DOM_MIN };
-    const config_path VIRUS_SIZE_MAX = { DOM_ENTITY, ENTITY_SARSCOV2, DOM_SIZE, DOM_MAX };
-    const config_path VIRUS_HEALTH_START = { DOM_ENTITY, ENTITY_SARSCOV2, DOM_HEALTH, "start"s };
-    const config_path VIRUS_HEALTH_INCREMENTS = { DOM_ENTITY, ENTITY_SARSCOV2, DOM_HEALTH, "increments"s };
-    const config_path VIRUS_HEALTH_INCREMENT_TIME = { DOM_ENTITY, ENTITY_SARSCOV2, DOM_HEALTH, "increment-time"s };
-    const config_path VIRUS_AGE_MATURITY = { DOM_ENTITY, ENTITY_SARSCOV2, "age-maturity"s };
-    const config_path VIRUS_GEST_MIN = { DOM_ENTITY, ENTITY_SARSCOV2, DOM_GESTATION, DOM_MIN };
-    const config_path VIRUS_GEST_MEAN = { DOM_ENTITY, ENTITY_SARSCOV2, DOM_GESTATION, DOM_MEAN };
-    const config_path VIRUS_GEST_STDEV = { DOM_ENTITY, ENTITY_SARSCOV2, DOM_GESTATION, DOM_STDEV };
+    constexpr Path VIRUS_IMAGE = fixed("entity/sars-cov2/image/virus");
+    constexpr Path VIRUS_PARTICLE = fixed("entity/sars-cov2/image/particle");
+    constexpr Path AUDIO_DEATH = fixed("entity/sars-cov2/audio/death");
+
+    constexpr Path VIRUS_ROTATE_RATE = fixed("entity/sars-cov2/rotate-rate");
+    constexpr Path VIRUS_SPEED = fixed("entity/sars-cov2/speed");
+    constexpr Path VIRUS_SIZE_MIN = fixed("entity/sars-cov2/size/min");
+    constexpr Path VIRUS_SIZE_MAX = fixed("entity/sars-cov2/size/max");
+    constexpr Path VIRUS_HEALTH_START = fixed("entity/sars-cov2/health/start");
+    constexpr Path VIRUS_HEALTH_INCREMENTS = fixed("entity/sars-cov2/health/increments");
+    constexpr Path VIRUS_HEALTH_INCREMENT_TIME = fixed("entity/sars-cov2/health/increment-time");
+    constexpr Path VIRUS_AGE_MATURITY = fixed("entity/sars-cov2/age-maturity");
+    constexpr Path VIRUS_GEST_MIN = fixed("entity/sars-cov2/gestation/min");
+    constexpr Path VIRUS_GEST_MEAN = fixed("entity/sars-cov2/gestation/mean");
+    constexpr Path VIRUS_GEST_STDEV = fixed("entity/sars-cov2/gestation/stdev");
 
     // --------------------------------------------------------------
     //
     // Entity: base-gun attributes
     //
     // --------------------------------------------------------------
-    const config_path BASIC_GUN_IMAGE_BULLET = { DOM_ENTITY, ENTITY_WEAPON_BASIC_GUN, DOM_IMAGE, DOM_BULLET };
-    const config_path BOMB_IMAGE = { DOM_ENTITY, ENTITY_WEAPON_BOMB, DOM_IMAGE, DOM_BULLET };
-    const config_path BASIC_GUN_AUDIO_FIRE = { DOM_ENTITY, ENTITY_WEAPON_BASIC_GUN, DOM_AUDIO, DOM_FIRE };
-    const config_path BOMB_AUDIO_FIRE = { DOM_ENTITY, ENTITY_WEAPON_BOMB, DOM_AUDIO, DOM_FIRE };
-    const config_path BOMB_AUDIO_EXPLODE = { DOM_ENTITY, ENTITY_WEAPON_BOMB, DOM_AUDIO, DOM_EXPLODE };
+    constexpr Path BASIC_GUN_IMAGE_BULLET = fixed("entity/basic-gun/image/bullet");
+    constexpr Path BOMB_IMAGE = fixed("entity/bomb/image/bullet");
+    constexpr Path BASIC_GUN_AUDIO_FIRE = fixed("entity/basic-gun/audio/fire");
+    constexpr Path BOMB_AUDIO_FIRE = fixed("entity/bomb/audio/fire");
+    constexpr Path BOMB_AUDIO_EXPLODE = fixed("entity/bomb/audio/explode");
 
     // --------------------------------------------------------------
     //
     // Entity: powerups
     //
     // --------------------------------------------------------------
-    const config_path POWERUP_RAPID_FIRE_IMAGE = { DOM_ENTITY, ENTITY_WEAPON_RAPID_FIRE, DOM_POWERUP, DOM_IMAGE };
-    const config_path POWERUP_RAPID_FIRE_AUDIO = { DOM_ENTITY, ENTITY_WEAPON_RAPID_FIRE, DOM_POWERUP, DOM_AUDIO };
+    constexpr Path POWERUP_RAPID_FIRE_IMAGE = fixed("entity/rapid-fire/powerup/image");
+    constexpr Path POWERUP_RAPID_FIRE_AUDIO = fixed("entity/rapid-fire/powerup/audio");
+
+    constexpr Path POWERUP_SPREAD_FIRE_IMAGE = fixed("entity/spread-fire/powerup/image");
+    constexpr Path POWERUP_SPREAD_FIRE_AUDIO = fixed("entity/spread-fire/powerup/audio");
 
-    const config_path POWERUP_SPREAD_FIRE_IMAGE = { DOM_ENTITY, ENTITY_WEAPON_SPREAD_FIRE, DOM_POWERUP, DOM_IMAGE };
-    const config_path POWERUP_SPREAD_FIRE_AUDIO = { DOM_ENTITY, ENTITY_WEAPON_SPREAD_FIRE, DOM_POWERUP, DOM_AUDIO };
+    constexpr Path POWERUP_BOMB_IMAGE = fixed("entity/bomb/powerup/image");
+    constexpr Path POWERUP_BOMB_AUDIO = fixed("entity/bomb/powerup/audio");
 
-    const config_path POWERUP_BOMB_IMAGE = { DOM_ENTITY, ENTITY_WEAPON_BOMB, DOM_POWERUP, DOM_IMAGE };
-    const config_path POWERUP_BOMB_AUDIO = { DOM_ENTITY, ENTITY_WEAPON_BOMB, DOM_POWERUP, DOM_AUDIO };
+    // --------------------------------------------------------------
+    //
+    // Particle effect names.  Each effect is made up of one or more
+    // emitters, the names of the emitters are not fixed, they are whatever
+    // appears in the configuration.
+    //
+    // --------------------------------------------------------------
+    constexpr auto DOM_EFFECTS = "effects";
+    constexpr auto EFFECT_VIRUS_DEATH = "virus-death";
+    constexpr auto EFFECT_PLAYER_DEATH = "player-death";
+    constexpr auto EFFECT_PLAYER_START = "player-start";
+
+    constexpr auto DOM_PATTERN = "pattern";
+    constexpr auto DOM_COUNT = "count";
+    constexpr auto DOM_DISTANCE = "distance";
+    constexpr auto DOM_SPEED = "speed";
+    constexpr auto DOM_SIZE_START = "size-start";
+    constexpr auto DOM_SIZE_END = "size-end";
+    constexpr auto DOM_ROTATION = "rotation";
+    constexpr auto DOM_CONVERGE = "converge";
+    constexpr auto DOM_SCALE_SUFFIX = "-scale"; // e.g., "count-scale": "bullets"
+    constexpr auto DOM_STDEV_SUFFIX = "-stdev"; // e.g., "distance-stdev": 6
 
     // --------------------------------------------------------------
     //
     // Level names
     //
     // --------------------------------------------------------------
-    const auto DOM_LEVELS = "levels"s;
-    const auto TRAINING_1 = "training-1"s;
-    const auto TRAINING_2 = "training-2"s;
-    const auto TRAINING_3 = "training-3"s;
-    const auto TRAINING_4 = "training-4"s;
-    const auto TRAINING_5 = "training-5"s;
-
-    const auto PATIENT_1 = "patient-1"s;
-    const auto PATIENT_2 = "patient-2"s;
-    const auto PATIENT_3 = "patient-3"s;
-
-    const config_path TRAINING_LEVEL1_NAME = { DOM_LEVELS, TRAINING_1, DOM_NAME };
-    const config_path TRAINING_LEVEL2_NAME = { DOM_LEVELS, TRAINING_2, DOM_NAME };
-    const config_path TRAINING_LEVEL3_NAME = { DOM_LEVELS, TRAINING_3, DOM_NAME };
-    const config_path TRAINING_LEVEL4_NAME = { DOM_LEVELS, TRAINING_4, DOM_NAME };
-    const config_path TRAINING_LEVEL5_NAME = { DOM_LEVELS, TRAINING_5, DOM_NAME };
-
-    const config_path PATIENT_LEVEL1_NAME = { DOM_LEVELS, PATIENT_1, DOM_NAME };
-    const config_path PATIENT_LEVEL2_NAME = { DOM_LEVELS, PATIENT_2, DOM_NAME };
-    const config_path PATIENT_LEVEL3_NAME = { DOM_LEVELS, PATIENT_3, DOM_NAME };
+    constexpr auto DOM_LEVELS = "levels";
+    constexpr auto TRAINING_1 = "training-1";
+    constexpr auto TRAINING_2 = "training-2";
+    constexpr auto TRAINING_3 = "training-3";
+    constexpr auto TRAINING_4 = "training-4";
+    constexpr auto TRAINING_5 = "training-5";
+
+    constexpr auto PATIENT_1 = "patient-1";
+    constexpr auto PATIENT_2 = "patient-2";
+    constexpr auto PATIENT_3 = "patient-3";
+
+    constexpr Path TRAINING_LEVEL1_NAME = fixed("levels/training-1/name");
+    constexpr Path TRAINING_LEVEL2_NAME = fixed("levels/training-2/name");
+    constexpr Path TRAINING_LEVEL3_NAME = fixed("levels/training-3/name");
+    constexpr Path TRAINING_LEVEL4_NAME = fixed("levels/training-4/name");
+    constexpr Path TRAINING_LEVEL5_NAME = fixed("levels/training-5/name");
+
+    constexpr Path PATIENT_LEVEL1_NAME = fixed("levels/patient-1/name");
+    constexpr Path PATIENT_LEVEL2_NAME = fixed("levels/patient-2/name");
+    constexpr Path PATIENT_LEVEL3_NAME = fixed("levels/patient-3/name");
 
 } // namespace config
@@ -0,0 +1,149 @@
+/*
+Copyright (c) 2021 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "levels/LevelName.hpp"
+#include "services/ConfigurationPath.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace config
+{
+    // --------------------------------------------------------------
+    //
+    // Weapons and levels are a fixed set, so their settings are kept in
+    // arrays indexed by these rather than looked up by name.  The name
+    // tables are in the same order as the enums and give the name each
+    // one has in the configuration.
+    //
+    // --------------------------------------------------------------
+    enum class WeaponName : std::uint8_t
+    {
+        BasicGun,
+        RapidFire,
+        SpreadFire,
+        Bomb
+    };
+
+    constexpr std::array WEAPON_NAMES{ ENTITY_WEAPON_BASIC_GUN, ENTITY_WEAPON_RAPID_FIRE, ENTITY_WEAPON_SPREAD_FIRE, ENTITY_WEAPON_BOMB };
+    constexpr std::array LEVEL_NAMES{ TRAINING_1, TRAINING_2, TRAINING_3, TRAINING_4, TRAINING_5, PATIENT_1, PATIENT_2, PATIENT_3 };
+
+    constexpr auto name(WeaponName weapon) { return WEAPON_NAMES[static_cast<std::size_t>(weapon)]; }
+    constexpr auto name(levels::LevelName level) { return LEVEL_NAMES[static_cast<std::size_t>(level)]; }
+
+    // --------------------------------------------------------------
+    //
+    // The game-play part of the configuration, compiled into plain
+    // structs once the configuration is read, so that reading a setting
+    // is a field access rather than a walk through the DOM.  Durations
+    // are already converted to std::chrono types; everything else is in
+    // the same units as the configuration.
+    //
+    // Only the developer (game-play) settings are here.  The user settings
+    // can change while the game runs and are still read through
+    // Configuration::get.
+    //
+    // --------------------------------------------------------------
+    struct PlayerSettings
+    {
+        double thrustRate{ 0.0 };
+        double dragRate{ 0.0 };
+        float rotateRate{ 0.0f }; // degrees per ms
+        float maxSpeed{ 0.0f };
+        float size{ 0.0f };
+    };
+
+    struct VirusSettings
+    {
+        float rotateRate{ 0.0f }; // degrees per ms
+        float speed{ 0.0f };
+        float sizeMin{ 0.0f };
+        float sizeMax{ 0.0f };
+        std::uint16_t healthStart{ 0 };
+        std::uint8_t healthIncrements{ 0 };
+        std::chrono::microseconds healthIncrementTime{ 0 };
+        std::chrono::microseconds ageMaturity{ 0 };
+        std::chrono::microseconds gestationMin{ 0 };
+        std::chrono::microseconds gestationMean{ 0 };
+        std::chrono::microseconds gestationStdev{ 0 };
+    };
+
+    struct WeaponSettings
+    {
+        std::chrono::microseconds fireDelay{ 0 };
+        std::uint16_t damage{ 0 };
+        std::chrono::microseconds lifetime{ 0 }; // Of the bullet (or bomb) it fires
+        float size{ 0.0f };
+    };
+
+    struct BombSettings
+    {
+        std::uint16_t bulletCount{ 0 };
+        std::uint16_t bulletDamage{ 0 };
+        float bulletSize{ 0.0f };
+        std::chrono::microseconds bulletLifetime{ 0 };
+    };
+
+    struct PowerupSettings
+    {
+        float size{ 0.0f };
+        std::chrono::microseconds lifetime{ 0 };
+        std::uint8_t spriteCount{ 0 };
+        std::chrono::microseconds spriteTime{ 0 };
+    };
+
+    struct LevelSettings
+    {
+        std::string name;
+        std::string backgroundImage;
+        std::string backgroundMusic;
+        std::string messageReady;
+        std::string messageSuccess;
+        std::string messageFailure;
+        std::uint8_t initialVirusCount{ 0 };
+        std::uint8_t maxVirusCount{ 0 };
+        std::uint8_t nanoBotCount{ 0 };
+        std::chrono::microseconds minPowerupTime{ 0 };
+        std::chrono::microseconds bombPowerupTime{ 0 };
+        std::chrono::microseconds rapidFirePowerupTime{ 0 };
+        std::chrono::microseconds spreadFirePowerupTime{ 0 };
+    };
+
+    struct Snapshot
+    {
+        PlayerSettings player;
+        VirusSettings virus;
+        BombSettings bomb;
+        std::array<WeaponSettings, WEAPON_NAMES.size()> weapons;   // Indexed by WeaponName
+        std::array<PowerupSettings, WEAPON_NAMES.size()> powerups; // By the weapon it gives, the basic gun has none
+        std::array<LevelSettings, LEVEL_NAMES.size()> levels;      // Indexed by levels::LevelName
+
+        const WeaponSettings& weapon(WeaponName which) const { return weapons[static_cast<std::size_t>(which)]; }
+        const PowerupSettings& powerup(WeaponName which) const { return powerups[static_cast<std::size_t>(which)]; }
+        const LevelSettings& level(levels::LevelName which) const { return levels[static_cast<std::size_t>(which)]; }
+    };
+} // namespace config
@@ -22,6 +22,7 @@ THE SOFTWARE.
 
 #include "services/Content.hpp"
 
+#include <algorithm>
 #include <filesystem>
 #include <iostream>
 
@@ -30,6 +31,8 @@ static const std::string CONTENT_FONT_PATH{ "fonts" };
 static const std::string CONTENT_IMAGE_PATH{ "images" };
 static const std::string CONTENT_AUDIO_PATH{ "audio" };
 static const std::string CONTENT_MUSIC_PATH{ "music" };
+static const std::string CONTENT_ARCHIVE{ "assets.pak" };
+static const std::string CONTENT_CACHE_PATH{ "cache" };
 
 // --------------------------------------------------------------
 //
@@ -37,10 +40,9 @@ static const std::string CONTENT_MUSIC_PATH{ "music" };
 //
 // --------------------------------------------------------------
 template <>
-void Content::load<sf::Font>(std::string key, std::string filename, std::function<void(std::string)> onComplete, std::function<void(std::string)> onError)
+Content::Handle Content::load<sf::Font>(content::Key key, std::string filename, std::function<void(std::string)> onComplete, std::function<void(std::string)> onError, Priority priority)
 {
-    instance().m_tasks.enqueue({ Task::Type::Font, key, filename, onComplete, onError });
-    instance().m_eventTasks.notify_one();
+    return instance().enqueue({ Task::Type::Font, key, filename, onComplete, onError, priority });
 }
 
 // --------------------------------------------------------------
@@ -49,10 +51,9 @@ void Content::load<sf::Font>(std::string key, std::string filename, std::functio
 //
 // --------------------------------------------------------------
 template <>
-void Content::load<sf::Texture>(std::string key, std::string filename, std::function<void(std::string)> onComplete, std::function<void(std::string)> onError)
+Content::Handle Content::load<sf::Texture>(content::Key key, std::string filename, std::function<void(std::string)> onComplete, std::function<void(std::string)> onError, Priority priority)
 {
-    instance().m_tasks.enqueue({ Task::Type::Texture, key, filename, onComplete, onError });
-    instance().m_eventTasks.notify_one();
+    return instance().enqueue({ Task::Type::Texture, key, filename, onComplete, onError, priority });
 }
 
 // --------------------------------------------------------------
@@ -61,10 +62,9 @@ void Content::load<sf::Texture>(std::string key, std::string filename, std::func
 //
 // --------------------------------------------------------------
 template <>
-void Content::load<sf::SoundBuffer>(std::string key, std::string filename, std::function<void(std::string)> onComplete, std::function<void(std::string)> onError)
+Content::Handle Content::load<sf::SoundBuffer>(content::Key key, std::string filename, std::function<void(std::string)> onComplete, std::function<void(std::string)> onError, Priority priority)
 {
-    instance().m_tasks.enqueue({ Task::Type::Audio, key, filename, onComplete, onError });
-    instance().m_eventTasks.notify_one();
+    return instance().enqueue({ Task::Type::Audio, key, filename, onComplete, onError, priority });
 }
 
 // --------------------------------------------------------------
@@ -73,10 +73,9 @@ void Content::load<sf::SoundBuffer>(std::string key, std::string filename, std::
 //
 // --------------------------------------------------------------
 template <>
-void Content::load<sf::Music>(std::string key, std::string filename, std::function<void(std::string)> onComplete, std::function<void(std::string)> onError)
+Content::Handle Content::load<sf::Music>(content::Key key, std::string filename, std::function<void(std::string)> onComplete, std::function<void(std::string)> onError, Priority priority)
 {
-    instance().m_tasks.enqueue({ Task::Type::Music, key, filename, onComplete, onError });
-    instance().m_eventTasks.notify_one();
+    return instance().enqueue({ Task::Type::Music, key, filename, onComplete, onError, priority });
 }
 
 // --------------------------------------------------------------
@@ -85,15 +84,15 @@ void Content::load<sf::Music>(std::string key, std::string filename, std::functi
 //
 // --------------------------------------------------------------
 template <>
-std::shared_ptr<sf::Font> Content::get(std::string key)
+std::shared_ptr<sf::Font> Content::get(content::Key key)
 {
-    return instance().m_fonts[key];
+    return instance().m_fonts.find(key.id());
 }
 
 template <>
-bool Content::has<sf::Font>(std::string key)
+bool Content::has<sf::Font>(content::Key key)
 {
-    return instance().m_fonts.find(key) != instance().m_fonts.end();
+    return instance().m_fonts.contains(key.id());
 }
 
 // --------------------------------------------------------------
@@ -102,15 +101,15 @@ bool Content::has<sf::Font>(std::string key)
 //
 // --------------------------------------------------------------
 template <>
-std::shared_ptr<sf::Texture> Content::get(std::string key)
+std::shared_ptr<sf::Texture> Content::get(content::Key key)
 {
-    return instance().m_textures[key];
+    return instance().m_textures.find(key.id());
 }
 
 template <>
-bool Content::has<sf::Texture>(std::string key)
+bool Content::has<sf::Texture>(content::Key key)
 {
-    return instance().m_textures.find(key) != instance().m_textures.end();
+    return instance().m_textures.contains(key.id());
 }
 
 // --------------------------------------------------------------
@@ -119,22 +118,22 @@ bool Content::has<sf::Texture>(std::string key)
 //
 // --------------------------------------------------------------
 template <>
-std::shared_ptr<sf::SoundBuffer> Content::get(std::string key)
+std::shared_ptr<sf::SoundBuffer> Content::get(content::Key key)
 {
-    return instance().m_audio[key];
+    return instance().m_audio.find(key.id());
 }
 
 template <>
-std::shared_ptr<sf::Sound> Content::get(std::string key)
+std::shared_ptr<sf::Sound> Content::get(content::Key key)
 {
-    return instance().m_sound[key];
+    return instance().m_sound.find(key.id());
 }
 
 // Only need has<sf::SoundBuffer>, because it is good for both sf::Sound and sf::SoundBuffer
 template <>
-bool Content::has<sf::SoundBuffer>(std::string key)
+bool Content::has<sf::SoundBuffer>(content::Key key)
 {
-    return instance().m_audio.find(key) != instance().m_audio.end();
+    return instance().m_audio.contains(key.id());
 }
 
 // --------------------------------------------------------------
@@ -143,45 +142,485 @@ bool Content::has<sf::SoundBuffer>(std::string key)
 //
 // --------------------------------------------------------------
 template <>
-std::shared_ptr<sf::Music> Content::get(std::string key)
+std::shared_ptr<sf::Music> Content::get(content::Key key)
 {
-    return instance().m_music[key];
+    return instance().m_music.find(key.id());
 }
 
 template <>
-bool Content::has<sf::Music>(std::string key)
+bool Content::has<sf::Music>(content::Key key)
 {
-    return instance().m_music.find(key) != instance().m_music.end();
+    return instance().m_music.contains(key.id());
 }
 
 // --------------------------------------------------------------
 //
-// Call this one time at program startup.  This gets the worker
-// thread up and running.
+// Call this one time at program startup.  This gets the loader
+// threads and the texture upload thread up and running.  The budget
+// is how many bytes of content can be resident before content nothing
+// references starts being evicted.
 //
 // --------------------------------------------------------------
-void Content::initialize()
+void Content::initialize(std::size_t budget)
 {
-    m_thread = std::make_unique<std::thread>(&Content::run, this);
+    m_statistics.budget = budget;
+
+    //
+    // The archive is optional, without it everything comes from the loose files
+    if (m_archive.open(CONTENT_ARCHIVE))
+    {
+        std::cout << "using asset archive: " << CONTENT_ARCHIVE << std::endl;
+        std::error_code error;
+        m_archiveTimestamp = std::filesystem::last_write_time(CONTENT_ARCHIVE, error).time_since_epoch().count();
+    }
+    m_cache.initialize(CONTENT_CACHE_PATH);
+
+    // Decoding is mostly file and CPU bound, leave a core for the game itself
+    auto howMany = std::clamp(std::thread::hardware_concurrency() / 2, 1u, MAX_LOADERS);
+    for (auto loader = 0u; loader < howMany; loader++)
+    {
+        m_loaders.emplace_back(&Content::runLoader, this);
+    }
+    m_uploader = std::make_unique<std::thread>(&Content::runUploader, this);
 }
 
 // --------------------------------------------------------------
 //
 // Call this one time as the program is shutting down.  This gets
-// the worker thread gracefully terminated.
+// the worker threads gracefully terminated.
 //
 // --------------------------------------------------------------
 void Content::terminate()
 {
     m_done = true;
-    m_eventTasks.notify_one();
-    m_thread->join();
+    {
+        std::lock_guard<std::mutex> lock(m_mutexTasks);
+        m_eventTasks.notify_all();
+    }
+    m_uploads.wakeAll();
+    for (auto& loader : m_loaders)
+    {
+        loader.join();
+    }
+    m_loaders.clear();
+    m_uploader->join();
 
     m_fonts.clear();
     m_textures.clear();
     m_audio.clear();
     m_music.clear();
     m_sound.clear();
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutexResidency);
+        std::cout << "content loads: " << m_statistics.loads;
+        if (m_statistics.loads > 0)
+        {
+            std::cout << ", average latency (us): " << m_statistics.loadLatencyTotal.count() / m_statistics.loads;
+            std::cout << ", max latency (us): " << m_statistics.loadLatencyMax.count();
+        }
+        std::cout << ", evictions: " << m_statistics.evictions << " (" << m_statistics.evicted << " bytes)";
+        std::cout << ", resident: " << m_statistics.residentCount << " (" << m_statistics.resident << " bytes)" << std::endl;
+
+        m_residency.clear();
+        m_lru.clear();
+    }
+
+    // Fonts and music keep reading from the mapping, so it goes away last
+    m_archive.close();
+}
+
+// --------------------------------------------------------------
+//
+// True while there is any content, of any priority, still waiting
+// to be loaded.
+//
+// --------------------------------------------------------------
+bool Content::anyPending()
+{
+    std::lock_guard<std::mutex> lock(m_mutexPending);
+    return std::any_of(m_pending.begin(), m_pending.end(), [](auto count) { return count > 0; });
+}
+
+// --------------------------------------------------------------
+//
+// Combines the handles into one that completes once all of them
+// have.  It is successful only if every one of them is.
+//
+// --------------------------------------------------------------
+Content::Handle Content::whenAll(const std::vector<Handle>& handles)
+{
+    // The group starts with one extra count, held until every handle is registered
+    auto group = std::make_shared<Handle::State>();
+    for (auto& handle : handles)
+    {
+        if (handle.m_state == nullptr)
+        {
+            continue;
+        }
+        std::lock_guard<std::mutex> lock(handle.m_state->mutex);
+        std::lock_guard<std::mutex> lockGroup(group->mutex);
+        if (handle.m_state->remaining > 0)
+        {
+            group->remaining++;
+            handle.m_state->dependents.push_back(group);
+        }
+        else if (!handle.m_state->success)
+        {
+            group->success = false;
+        }
+    }
+    Handle::complete(group, true);
+
+    return Handle(group);
+}
+
+bool Content::Handle::isReady() const
+{
+    if (m_state == nullptr)
+    {
+        return true;
+    }
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    return m_state->remaining == 0;
+}
+
+bool Content::Handle::get() const
+{
+    if (m_state == nullptr)
+    {
+        return true;
+    }
+    std::unique_lock<std::mutex> lock(m_state->mutex);
+    m_state->event.wait(lock, [this]() { return m_state->remaining == 0; });
+    return m_state->success;
+}
+
+// --------------------------------------------------------------
+//
+// Counts one completion against the state.  When it reaches zero,
+// anyone waiting is woken up and any groups depending on it are
+// completed in turn.  No lock is held while completing the groups.
+//
+// --------------------------------------------------------------
+void Content::Handle::complete(const std::shared_ptr<State>& state, bool success)
+{
+    std::vector<std::shared_ptr<State>> dependents;
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->success = state->success && success;
+        if (--state->remaining > 0)
+        {
+            return;
+        }
+        success = state->success;
+        dependents.swap(state->dependents);
+        state->event.notify_all();
+    }
+
+    for (auto& dependent : dependents)
+    {
+        complete(dependent, success);
+    }
+}
+
+// --------------------------------------------------------------
+//
+// Adds the task to the queue for its priority and wakes up a loader.
+//
+// If the same content is already in flight, the request shares its
+// handle instead.  When the new request is the more urgent one, a copy
+// of the task is also queued at the new priority; whichever copy a
+// loader claims first is loaded, the other is dropped when dequeued.
+//
+// --------------------------------------------------------------
+Content::Handle Content::enqueue(Task task)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutexPending);
+        if (auto itr = m_requests.find(task.key.id()); itr != m_requests.end())
+        {
+            auto& request = itr->second;
+            if (task.onComplete != nullptr)
+            {
+                request.onComplete.push_back(task.onComplete);
+            }
+            if (task.onError != nullptr)
+            {
+                request.onError.push_back(task.onError);
+            }
+            if (task.priority >= request.task.priority || *request.task.claimed)
+            {
+                return Handle(request.task.state);
+            }
+            request.task.priority = task.priority;
+            task = request.task;
+        }
+        else
+        {
+            m_requests.emplace(task.key.id(), Request{ task, {}, {} });
+        }
+        m_pending[static_cast<std::size_t>(task.priority)]++;
+    }
+    Handle handle(task.state);
+    // Counted before it is enqueued, so a loader can never see the task without the count
+    m_queued++;
+    auto& tasks = m_tasks[static_cast<std::size_t>(task.priority)];
+    while (!tasks.enqueue(std::move(task)))
+    {
+        // Only happens with more than a thousand loads waiting at the same priority
+        std::this_thread::yield();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutexTasks);
+        m_eventTasks.notify_one();
+    }
+
+    return handle;
+}
+
+// --------------------------------------------------------------
+//
+// Returns the next task, taken from the highest priority queue that
+// has anything in it.  Copies of a promoted task that have already
+// been claimed are dropped along the way.
+//
+// --------------------------------------------------------------
+std::optional<Content::Task> Content::nextTask()
+{
+    for (auto& tasks : m_tasks)
+    {
+        for (auto task = tasks.dequeue(); task.has_value(); task = tasks.dequeue())
+        {
+            m_queued--;
+            if (!task->claimed->exchange(true))
+            {
+                return task;
+            }
+            std::lock_guard<std::mutex> lock(m_mutexPending);
+            m_pending[static_cast<std::size_t>(task->priority)]--;
+        }
+    }
+
+    return std::nullopt;
+}
+
+// --------------------------------------------------------------
+//
+// Reports the result of a task and completes its handle.  The handle
+// is only completed after the callbacks, so a waiter never returns
+// while a callback is still running.
+//
+// --------------------------------------------------------------
+void Content::finish(Task& task, bool success)
+{
+    if (success)
+    {
+        std::cout << "finished loading: " << task.key.name() << std::endl;
+        makeResident(task);
+    }
+    else
+    {
+        m_contentError = true;
+        std::cout << "error in loading: " << task.filename << std::endl;
+    }
+
+    std::vector<std::function<void(std::string)>> onComplete;
+    std::vector<std::function<void(std::string)>> onError;
+    {
+        std::lock_guard<std::mutex> lock(m_mutexPending);
+        if (auto itr = m_requests.find(task.key.id()); itr != m_requests.end())
+        {
+            onComplete.swap(itr->second.onComplete);
+            onError.swap(itr->second.onError);
+            m_requests.erase(itr);
+        }
+    }
+    if (task.onComplete != nullptr)
+    {
+        onComplete.insert(onComplete.begin(), task.onComplete);
+    }
+    if (task.onError != nullptr)
+    {
+        onError.insert(onError.begin(), task.onError);
+    }
+
+    for (auto& callback : success ? onComplete : onError)
+    {
+        callback(success ? task.key.name() : task.filename);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutexPending);
+        m_pending[static_cast<std::size_t>(task.priority)]--;
+    }
+    Handle::complete(task.state, success);
+}
+
+Content::Statistics Content::statistics()
+{
+    std::lock_guard<std::mutex> lock(instance().m_mutexResidency);
+    return instance().m_statistics;
+}
+
+void Content::Group::add(content::Key key)
+{
+    instance().acquire(key);
+    m_keys.push_back(key);
+}
+
+void Content::Group::clear()
+{
+    for (auto key : m_keys)
+    {
+        instance().release(key);
+    }
+    m_keys.clear();
+}
+
+void Content::acquire(content::Key key)
+{
+    std::lock_guard<std::mutex> lock(m_mutexResidency);
+    auto& residency = m_residency[key.id()];
+    if (residency.references++ == 0 && residency.resident)
+    {
+        m_lru.erase(residency.lru);
+    }
+}
+
+// --------------------------------------------------------------
+//
+// Once the last reference goes away the content becomes the most
+// recently used of the content that can be evicted.
+//
+// --------------------------------------------------------------
+void Content::release(content::Key key)
+{
+    std::lock_guard<std::mutex> lock(m_mutexResidency);
+    auto itr = m_residency.find(key.id());
+    if (itr == m_residency.end() || itr->second.references == 0)
+    {
+        return;
+    }
+    auto& residency = itr->second;
+    if (--residency.references == 0)
+    {
+        if (residency.resident)
+        {
+            residency.lru = m_lru.insert(m_lru.end(), key.id());
+            evict();
+        }
+        else
+        {
+            m_residency.erase(itr);
+        }
+    }
+}
+
+// --------------------------------------------------------------
+//
+// Accounts for content that just finished loading.  Content loaded
+// again while still resident replaces the previous copy.
+//
+// --------------------------------------------------------------
+void Content::makeResident(const Task& task)
+{
+    std::lock_guard<std::mutex> lock(m_mutexResidency);
+    auto& residency = m_residency[task.key.id()];
+    if (residency.resident)
+    {
+        m_statistics.resident -= residency.bytes;
+        m_statistics.residentCount--;
+    }
+    else if (residency.references == 0)
+    {
+        residency.lru = m_lru.insert(m_lru.end(), task.key.id());
+    }
+    residency.type = task.type;
+    residency.bytes = task.bytes;
+    residency.resident = true;
+
+    m_statistics.resident += task.bytes;
+    m_statistics.residentCount++;
+    auto latency = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - task.requested);
+    m_statistics.loads++;
+    m_statistics.loadLatencyTotal += latency;
+    m_statistics.loadLatencyMax = std::max(m_statistics.loadLatencyMax, latency);
+
+    evict();
+}
+
+// --------------------------------------------------------------
+//
+// Evicts content nobody references, least recently used first, until
+// the resident content fits in the budget again, or there is nothing
+// left that can be evicted.  Must be called holding m_mutexResidency.
+//
+// Anything still holding a pointer to evicted content keeps it alive
+// until it lets go, it just can't be found through get anymore.
+//
+// --------------------------------------------------------------
+void Content::evict()
+{
+    while (m_statistics.resident > m_statistics.budget && !m_lru.empty())
+    {
+        auto id = m_lru.front();
+        m_lru.pop_front();
+        auto itr = m_residency.find(id);
+        switch (itr->second.type)
+        {
+            case Task::Type::Font:
+                m_fonts.erase(id);
+                break;
+            case Task::Type::Texture:
+                m_textures.erase(id);
+                break;
+            case Task::Type::Audio:
+                m_audio.erase(id);
+                m_sound.erase(id);
+                break;
+            case Task::Type::Music:
+                m_music.erase(id);
+                break;
+        }
+        std::cout << "evicted: " << content::Key(id).name() << std::endl;
+
+        m_statistics.resident -= itr->second.bytes;
+        m_statistics.residentCount--;
+        m_statistics.evictions++;
+        m_statistics.evicted += itr->second.bytes;
+        m_residency.erase(itr);
+    }
+}
+
+// --------------------------------------------------------------
+//
+// Identifies the version of an asset for the decoded cache: the
+// archive it is packed in, or its loose file.  Nothing is returned
+// when the asset can't be found, in which case it isn't cached.
+//
+// --------------------------------------------------------------
+std::optional<DecodedCache::Source> Content::sourceOf(const std::string& name, const std::filesystem::path& path, const std::optional<AssetArchive::Asset>& packed)
+{
+    if (packed.has_value())
+    {
+        return DecodedCache::Source{ name, m_archiveTimestamp, packed->size };
+    }
+
+    std::error_code error;
+    auto timestamp = std::filesystem::last_write_time(path, error);
+    if (error)
+    {
+        return std::nullopt;
+    }
+    auto size = std::filesystem::file_size(path, error);
+    if (error)
+    {
+        return std::nullopt;
+    }
+
+    return DecodedCache::Source{ name, timestamp.time_since_epoch().count(), size };
 }
 
 // --------------------------------------------------------------
@@ -197,19 +636,22 @@ bool Content::loadImpl<sf::Font>(Task& task)
     path /= task.filename;
 
     auto font = std::make_shared<sf::Font>();
-    if (!font->loadFromFile(path.string()))
+    auto packed = m_archive.find(CONTENT_FONT_PATH + "/" + task.filename);
+    if (packed.has_value() ? !font->loadFromMemory(packed->data, packed->size) : !font->loadFromFile(path.string()))
     {
         return false;
     }
 
-    instance().m_fonts[task.key] = font;
+    std::error_code error;
+    task.bytes = packed.has_value() ? packed->size : static_cast<std::size_t>(std::filesystem::file_size(path, error));
+    m_fonts.insert(task.key.id(), font);
 
     return true;
 }
 
 // --------------------------------------------------------------
 //
-// Specialization on sf::Texture for loading textures (for adding to sprites for rendering)
+// Specialization on sf::Texture for decoding the image of a texture
 //
 // --------------------------------------------------------------
 template <>
@@ -219,13 +661,24 @@ bool Content::loadImpl<sf::Texture>(Task& task)
     path /= CONTENT_IMAGE_PATH;
     path /= task.filename;
 
-    auto image = std::make_shared<sf::Texture>();
-    if (!image->loadFromFile(path.string()))
+    //
+    // Only decode it here, the texture itself is created on the upload thread
+    task.image = std::make_shared<sf::Image>();
+    auto packed = m_archive.find(CONTENT_IMAGE_PATH + "/" + task.filename);
+    auto source = sourceOf(CONTENT_IMAGE_PATH + "/" + task.filename, path, packed);
+    if (source.has_value() && m_cache.load(*source, *task.image))
     {
-        return false;
+        return true;
     }
 
-    instance().m_textures[task.key] = image;
+    if (packed.has_value() ? !task.image->loadFromMemory(packed->data, packed->size) : !task.image->loadFromFile(path.string()))
+    {
+        return false;
+    }
+    if (source.has_value())
+    {
+        m_cache.save(*source, *task.image);
+    }
 
     return true;
 }
@@ -243,15 +696,29 @@ bool Content::loadImpl<sf::SoundBuffer>(Task& task)
     path /= task.filename;
 
     auto audio = std::make_shared<sf::SoundBuffer>();
-    if (!audio->loadFromFile(path.string()))
+    auto packed = m_archive.find(CONTENT_AUDIO_PATH + "/" + task.filename);
+    auto source = sourceOf(CONTENT_AUDIO_PATH + "/" + task.filename, path, packed);
+    if (!source.has_value() || !m_cache.load(*source, *audio))
     {
-        return false;
+        if (packed.has_value() ? !audio->loadFromMemory(packed->data, packed->size) : !audio->loadFromFile(path.string()))
+        {
+            return false;
+        }
+        if (source.has_value())
+        {
+            m_cache.save(*source, *audio);
+        }
     }
 
-    instance().m_audio[task.key] = audio;
+    task.bytes = static_cast<std::size_t>(audio->getSampleCount()) * sizeof(sf::Int16);
+
     // Create the matching sf::Sound that can be used to directly play the sound if desired
-    instance().m_sound[task.key] = std::make_shared<sf::Sound>();
-    instance().m_sound[task.key]->setBuffer(*audio);
+    auto sound = std::make_shared<sf::Sound>();
+    sound->setBuffer(*audio);
+
+    // The sound goes in first, has<sf::SoundBuffer> must mean both are available
+    m_sound.insert(task.key.id(), sound);
+    m_audio.insert(task.key.id(), audio);
 
     return true;
 }
@@ -268,22 +735,29 @@ bool Content::loadImpl<sf::Music>(Task& task)
     path /= CONTENT_MUSIC_PATH;
     path /= task.filename;
 
+    //
+    // Music streams from the mapping for as long as it plays
     auto audio = std::make_shared<sf::Music>();
-    if (!audio->openFromFile(path.string()))
+    auto packed = m_archive.find(CONTENT_MUSIC_PATH + "/" + task.filename);
+    if (packed.has_value() ? !audio->openFromMemory(packed->data, packed->size) : !audio->openFromFile(path.string()))
     {
         return false;
     }
 
-    instance().m_music[task.key] = audio;
+    // Only a second of it is decoded at a time, into the stream buffer
+    task.bytes = static_cast<std::size_t>(audio->getSampleRate()) * audio->getChannelCount() * sizeof(sf::Int16);
+    m_music.insert(task.key.id(), audio);
 
     return true;
 }
 
 // --------------------------------------------------------------
 //
-// This is the worker thread.  It pulls tasks from the queue and
-// completes them.  If there are no tasks, it goes into an efficient
-// wait state until a new task is added.
+// This is a loader thread.  It pulls tasks from the queues, highest
+// priority first, and completes them.  Decoded textures are passed
+// along to the upload thread rather than completed here.  If there
+// are no tasks, it goes into an efficient wait state until a new task
+// is added.
 //
 // Note: This method must come AFTER the template specializations for
 //       the loadImpl method.  If it doesn't, the compiler tries to
@@ -291,12 +765,11 @@ bool Content::loadImpl<sf::Music>(Task& task)
 //       it has a little fit.
 //
 // --------------------------------------------------------------
-void Content::run()
+void Content::runLoader()
 {
     while (!m_done)
     {
-        m_processing = true;
-        auto task = m_tasks.dequeue();
+        auto task = nextTask();
         if (task.has_value())
         {
             bool success{ false };
@@ -315,30 +788,54 @@ void Content::run()
                     success = loadImpl<sf::Music>(*task);
                     break;
             }
-            if (success)
-            {
-                std::cout << "finished loading: " << task->key << std::endl;
-            }
-            else
-            {
-                m_contentError = true;
-                std::cout << "error in loading: " << task->filename << std::endl;
-            }
 
-            if (success && task->onComplete != nullptr)
+            if (success && task->type == Task::Type::Texture)
             {
-                task->onComplete(task->key);
+                while (!m_uploads.enqueue(std::move(*task)))
+                {
+                    // The uploader is far behind, let it catch up
+                    std::this_thread::yield();
+                }
             }
-            else if (!success && task->onError != nullptr)
+            else
             {
-                task->onError(task->filename);
+                finish(*task, success);
             }
         }
         else
         {
-            m_processing = false;
             std::unique_lock<std::mutex> lock(m_mutexTasks);
-            m_eventTasks.wait(lock);
+            m_eventTasks.wait(lock, [this]() { return m_done || m_queued > 0; });
+        }
+    }
+}
+
+// --------------------------------------------------------------
+//
+// This is the upload thread.  It is the one thread that creates
+// textures from the images decoded by the loaders, which keeps the
+// GPU work on a single context and in the order it was decoded.
+// If there are no textures to upload, it waits in the queue until
+// one is added.
+//
+// --------------------------------------------------------------
+void Content::runUploader()
+{
+    while (!m_done)
+    {
+        auto task = m_uploads.waitDequeue(m_done);
+        if (task.has_value())
+        {
+            auto texture = std::make_shared<sf::Texture>();
+            bool success = texture->loadFromImage(*task->image);
+            if (success)
+            {
+                task->bytes = static_cast<std::size_t>(task->image->getSize().x) * task->image->getSize().y * 4;
+                m_textures.insert(task->key.id(), texture);
+            }
+            task->image.reset();
+
+            finish(*task, success);
         }
     }
-}
\ No newline at end of file
+}
@@ -23,26 +23,52 @@ THE SOFTWARE.
 #pragma once
 
 #include "misc/ConcurrentQueue.hpp"
+#include "misc/RcuTable.hpp"
+#include "services/AssetArchive.hpp"
+#include "services/ContentKey.hpp"
+#include "services/DecodedCache.hpp"
 
 #include <SFML/Audio/Music.hpp>
 #include <SFML/Audio/Sound.hpp>
 #include <SFML/Audio/SoundBuffer.hpp>
 #include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Image.hpp>
 #include <SFML/Graphics/Texture.hpp>
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstdint>
+#include <filesystem>
 #include <functional>
+#include <list>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <thread>
 #include <unordered_map>
+#include <vector>
 
 // --------------------------------------------------------------
 //
 // Used to hold content used throughout the game.  Things like
 // fonts, images, sound, etc.
 //
+// Content is decoded on a pool of loader threads, highest priority
+// first.  Textures are decoded into an sf::Image by the loaders and
+// then handed to a single upload thread, which is the only thread
+// that creates GPU textures.
+//
+// When the packed asset archive is present, assets are loaded from its
+// memory mapping, otherwise from the loose files in the assets folder.
+// Decoded images and audio clips are kept in an on-disk cache, so
+// later launches skip decoding them.
+//
+// Content is referenced through groups.  Once nothing references a
+// piece of content it stays resident, but is evicted, least recently
+// used first, whenever resident content goes over the memory budget.
+//
 // Note: This is a Singleton
 //
 // --------------------------------------------------------------
@@ -54,7 +80,7 @@ class Content
     Content& operator=(const Content&) = delete;
     Content& operator=(Content&&) = delete;
 
-    void initialize();
+    void initialize(std::size_t budget);
     void terminate();
 
     static auto& instance()
@@ -63,19 +89,114 @@ class Content
         return instance;
     }
 
+    // Pending content is loaded in this order.  Prefetch is for content
+    // that might be needed soon, it only loads when nothing else is waiting.
+    enum class Priority : std::uint8_t
+    {
+        Menu,
+        Gameplay,
+        Level,
+        Prefetch
+    };
+
+    // --------------------------------------------------------------
+    //
+    // Returned from load, completes once the content has either loaded
+    // or failed.  Use whenAll to combine the handles for a group of
+    // content into a single handle.  A default constructed handle is
+    // already complete and successful.
+    //
+    // --------------------------------------------------------------
+    class Handle
+    {
+      public:
+        Handle() = default;
+
+        bool isReady() const;
+        bool get() const; // Efficient wait until complete, true if all of the content loaded
+
+      private:
+        friend class Content;
+
+        struct State
+        {
+            std::mutex mutex;
+            std::condition_variable event;
+            std::uint32_t remaining{ 1 };
+            bool success{ true };
+            std::vector<std::shared_ptr<State>> dependents; // whenAll groups waiting on this one
+        };
+
+        explicit Handle(std::shared_ptr<State> state) :
+            m_state(state)
+        {
+        }
+
+        static void complete(const std::shared_ptr<State>& state, bool success);
+
+        std::shared_ptr<State> m_state;
+    };
+
+    static Handle whenAll(const std::vector<Handle>& handles);
+
+    // --------------------------------------------------------------
+    //
+    // Holds a reference on each piece of content loaded through it, for
+    // as long as the group is around.  Groups belong to whatever needs
+    // the content: the menu, the gameplay view, a level.  Content loaded
+    // without a group, such as prefetched content, is never referenced.
+    //
+    // --------------------------------------------------------------
+    class Group
+    {
+      public:
+        Group() = default;
+        Group(const Group&) = delete;
+        Group& operator=(const Group&) = delete;
+        ~Group() { clear(); }
+
+        template <typename T>
+        Handle load(content::Key key, std::string filename, Priority priority = Priority::Gameplay)
+        {
+            add(key);
+            return Content::load<T>(key, filename, nullptr, nullptr, priority);
+        }
+
+        void add(content::Key key); // References content whether or not it is loaded yet
+        void clear();
+
+      private:
+        std::vector<content::Key> m_keys;
+    };
+
+    // Memory use of the resident content, all sizes are in bytes
+    struct Statistics
+    {
+        std::size_t budget{ 0 };
+        std::size_t resident{ 0 };
+        std::uint32_t residentCount{ 0 };
+        std::uint32_t evictions{ 0 };
+        std::size_t evicted{ 0 };
+        std::uint32_t loads{ 0 };
+        std::chrono::microseconds loadLatencyTotal{ 0 }; // From being requested until resident
+        std::chrono::microseconds loadLatencyMax{ 0 };
+    };
+
+    static Statistics statistics();
+
     // This is a template so it is possible to specialize based on type, because there
     // isn't a parameter on which to overload.
     template <typename T>
-    static void load(std::string key, std::string filename, std::function<void(std::string)> onComplete = nullptr, std::function<void(std::string)> onError = nullptr);
+    static Handle load(content::Key key, std::string filename, std::function<void(std::string)> onComplete = nullptr, std::function<void(std::string)> onError = nullptr, Priority priority = Priority::Gameplay);
 
     // This is a template with specializations, because can't overload on return type
     template <typename T>
-    static std::shared_ptr<T> get(std::string key);
+    static std::shared_ptr<T> get(content::Key key);
 
     template <typename T>
-    static bool has(std::string key);
+    static bool has(content::Key key);
 
-    bool anyPending() { return m_tasks.size() > 0 || m_processing; }
+    bool anyPending();
     bool isError() { return m_contentError; }
 
   private:
@@ -92,39 +213,103 @@ class Content
             Music
         };
 
-        Task(Type type, std::string key, std::string filename, std::function<void(std::string)> onComplete, std::function<void(std::string)> onError) :
+        Task(Type type, content::Key key, std::string filename, std::function<void(std::string)> onComplete, std::function<void(std::string)> onError, Priority priority) :
             type(type),
             key(key),
             filename(filename),
             onComplete(onComplete),
-            onError(onError)
+            onError(onError),
+            priority(priority),
+            state(std::make_shared<Handle::State>()),
+            claimed(std::make_shared<std::atomic_bool>(false)),
+            requested(std::chrono::steady_clock::now())
         {
         }
 
         Type type;
-        std::string key;
+        content::Key key;
         std::string filename;
         std::function<void(std::string)> onComplete;
         std::function<void(std::string)> onError;
+        Priority priority;
+        std::shared_ptr<Handle::State> state;
+        std::shared_ptr<std::atomic_bool> claimed; // Shared by the copies of a promoted task, the first loader to claim it wins
+        std::shared_ptr<sf::Image> image;          // Decoded texture waiting for upload
+        std::chrono::steady_clock::time_point requested;
+        std::size_t bytes{ 0 }; // Estimated memory use, once loaded
     };
 
-    std::unordered_map<std::string, std::shared_ptr<sf::Font>> m_fonts;
-    std::unordered_map<std::string, std::shared_ptr<sf::Texture>> m_textures;
-    std::unordered_map<std::string, std::shared_ptr<sf::SoundBuffer>> m_audio;
-    std::unordered_map<std::string, std::shared_ptr<sf::Music>> m_music;
+    //
+    // A load that has been queued, but not yet finished.  Requests for the
+    // same content while it is in flight share its handle rather than load
+    // it again, and move it up to their priority if that is more urgent.
+    struct Request
+    {
+        Task task;
+        std::vector<std::function<void(std::string)>> onComplete; // From the requests that were shared
+        std::vector<std::function<void(std::string)>> onError;
+    };
+
+    //
+    // Written by the loader and upload threads, read from everywhere.  Indexed
+    // by the content key id, and being read-copy-update tables, a lookup never
+    // hashes a string nor waits on content being loaded.
+    RcuTable<sf::Font> m_fonts;
+    RcuTable<sf::Texture> m_textures;
+    RcuTable<sf::SoundBuffer> m_audio;
+    RcuTable<sf::Music> m_music;
 
     // Has to be a shared_ptr, because can't have both T get and std::shared_ptr<T> get
-    std::unordered_map<std::string, std::shared_ptr<sf::Sound>> m_sound;
+    RcuTable<sf::Sound> m_sound;
+
+    static constexpr std::size_t PRIORITY_COUNT{ 4 };
+    static constexpr unsigned int MAX_LOADERS{ 4 };
 
-    bool m_done{ false };
-    std::unique_ptr<std::thread> m_thread;
-    ConcurrentQueue<Task> m_tasks;
-    std::atomic_bool m_processing{ false };
+    std::atomic_bool m_done{ false };
+    std::vector<std::thread> m_loaders;
+    std::unique_ptr<std::thread> m_uploader;
+    std::array<ConcurrentQueue<Task>, PRIORITY_COUNT> m_tasks;
+    ConcurrentQueue<Task> m_uploads;
+    std::atomic_uint32_t m_queued{ 0 }; // Across all of the priorities, so a loader knows when to wait
     std::atomic_bool m_contentError{ false };
     std::condition_variable m_eventTasks;
     std::mutex m_mutexTasks;
 
-    void run();
+    std::array<std::uint32_t, PRIORITY_COUNT> m_pending{};
+    std::unordered_map<std::uint16_t, Request> m_requests; // By content key id
+    std::mutex m_mutexPending;
+
+    //
+    // Tracks the references and memory use of content.  Resident content
+    // without any references is kept in m_lru in the order it was last
+    // referenced (or loaded), which is the order it is evicted in.
+    struct Residency
+    {
+        Task::Type type{ Task::Type::Font };
+        std::uint32_t references{ 0 };
+        std::size_t bytes{ 0 };
+        bool resident{ false };
+        std::list<std::uint16_t>::iterator lru; // Only valid while resident without references
+    };
+    std::unordered_map<std::uint16_t, Residency> m_residency; // By content key id
+    std::list<std::uint16_t> m_lru;
+    Statistics m_statistics;
+    std::mutex m_mutexResidency;
+
+    AssetArchive m_archive;
+    std::int64_t m_archiveTimestamp{ 0 };
+    DecodedCache m_cache;
+
+    Handle enqueue(Task task);
+    std::optional<Task> nextTask();
+    void finish(Task& task, bool success);
+    void acquire(content::Key key);
+    void release(content::Key key);
+    void makeResident(const Task& task);
+    void evict();
+    void runLoader();
+    void runUploader();
+    std::optional<DecodedCache::Source> sourceOf(const std::string& name, const std::filesystem::path& path, const std::optional<AssetArchive::Asset>& packed);
 
     template <typename T>
     bool loadImpl(Task& task);
@@ -0,0 +1,101 @@
+/*
+Copyright (c) 2021 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "services/ContentKey.hpp"
+
+#include <deque>
+#include <iostream>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace content
+{
+    // --------------------------------------------------------------
+    //
+    // The intern table, seeded with the fixed names so their ids match.
+    // A deque, so the names never move once added and name() can hand
+    // out references to them.
+    //
+    // --------------------------------------------------------------
+    class Registry
+    {
+      public:
+        static Registry& instance()
+        {
+            static Registry instance;
+            return instance;
+        }
+
+        std::uint16_t intern(const std::string& name)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (auto itr = m_ids.find(name); itr != m_ids.end())
+            {
+                return itr->second;
+            }
+            // The largest id is reserved for default constructed keys.  Handing
+            // out any other id would silently alias existing content.
+            if (m_names.size() >= std::numeric_limits<std::uint16_t>::max())
+            {
+                std::cout << "too many content keys, unable to add: " << name << std::endl;
+                throw std::length_error("content key ids exhausted");
+            }
+            auto id = static_cast<std::uint16_t>(m_names.size());
+            m_names.push_back(name);
+            m_ids[name] = id;
+
+            return id;
+        }
+
+        const std::string& name(std::uint16_t id)
+        {
+            static const std::string none;
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return id < m_names.size() ? m_names[id] : none;
+        }
+
+      private:
+        Registry()
+        {
+            for (auto name : FIXED_NAMES)
+            {
+                intern(std::string(name));
+            }
+        }
+
+        std::mutex m_mutex;
+        std::unordered_map<std::string, std::uint16_t> m_ids;
+        std::deque<std::string> m_names;
+    };
+
+    Key::Key(const std::string& name) :
+        m_id(Registry::instance().intern(name))
+    {
+    }
+
+    const std::string& Key::name() const
+    {
+        return Registry::instance().name(m_id);
+    }
+} // namespace content
@@ -22,46 +22,136 @@ THE SOFTWARE.
 
 #pragma once
 
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 
 namespace content
 {
-    using namespace std::string_literals;
-
-    const auto KEY_FONT_TITLE = "font/title"s;
-    const auto KEY_FONT_MENU = "font/menu"s;
-    const auto KEY_FONT_CREDITS = "font/credits"s;
-    const auto KEY_FONT_GAME_STATUS = "font/game-status"s;
-    const auto KEY_FONT_SETTINGS = "font/settings"s;
-    const auto KEY_FONT_LEVEL_SELECT = "font/level-select";
-    const auto KEY_FONT_GAMEPLAY = "font/gameplay";
-
-    const auto KEY_IMAGE_MENU_BACKGROUND = "image/menu-background"s;
-
-    const auto KEY_MENU_ACTIVATE = "audio/menu-activate"s;
-    const auto KEY_MENU_ACCEPT = "audio/menu-accept"s;
-
-    const auto KEY_IMAGE_PLAYER = "image/player"s;
-    const auto KEY_IMAGE_BASIC_GUN_BULLET = "image/bullet"s;
-    const auto KEY_IMAGE_BOMB = "image/bomb"s;
-    const auto KEY_IMAGE_SARSCOV2 = "image/sars-cov2"s;
-    const auto KEY_IMAGE_SARSCOV2_PARTICLE = "image/sars-cov2-particle"s;
-    const auto KEY_IMAGE_PLAYER_PARTICLE = "image/player-particle"s;
-    const auto KEY_IMAGE_POWERUP_RAPID_FIRE = "image/powerup-rapid-fire"s;
-    const auto KEY_IMAGE_POWERUP_SPREAD_FIRE = "image/powerup-spread-fire"s;
-    const auto KEY_IMAGE_POWERUP_BOMB = "image/powerup-bomb"s;
-    const auto KEY_IMAGE_PLAYER_START_PARTICLE = "image/player-start-particle"s;
-
-    const auto KEY_AUDIO_VIRUS_DEATH = "audio/virus-death"s;
-    const auto KEY_AUDIO_PLAYER_DEATH = "audio/player-death"s;
-    const auto KEY_AUDIO_PLAYER_START = "audio/player-start"s;
-    const auto KEY_AUDIO_THRUST = "audio/thrust"s;
-    const auto KEY_AUDIO_BASIC_GUN_FIRE = "audio/fire"s;
-    const auto KEY_AUDIO_RAPID_GUN_FIRE = "audio/fire"s;
-    const auto KEY_AUDIO_SPREAD_GUN_FIRE = "audio/fire"s;
-    const auto KEY_AUDIO_BOMB_FIRE = "audio/bomb-fire"s;
-    const auto KEY_AUDIO_BOMB_EXPLODE = "audio/bomb-explode"s;
-    const auto KEY_AUDIO_RAPID_GUN_POWERUP = "audio/powerup-rapid-fire"s;
-    const auto KEY_AUDIO_SPREAD_GUN_POWERUP = "audio/powerup-spread-fire"s;
-    const auto KEY_AUDIO_BOMB_POWERUP = "audio/powerup-bomb"s;
+    // --------------------------------------------------------------
+    //
+    // Content is identified by an interned key: a small integer id that
+    // indexes directly into the content tables, so looking up content
+    // never hashes a string.  The keys below are fixed at compile time,
+    // their ids are their position in FIXED_NAMES.  Any other name (the
+    // level backgrounds, or images named in the effects configuration)
+    // is interned the first time it is seen and given the next free id;
+    // a name matching one of the fixed keys gets that same id.
+    //
+    // --------------------------------------------------------------
+    class Key
+    {
+      public:
+        // Default constructed keys name no content at all
+        constexpr Key() :
+            m_id(NONE)
+        {
+        }
+        constexpr explicit Key(std::uint16_t id) :
+            m_id(id)
+        {
+        }
+        // Interning takes a lock and hashes the name, so it is never done implicitly
+        explicit Key(const std::string& name);
+        explicit Key(const char* name) :
+            Key(std::string(name))
+        {
+        }
+
+        constexpr std::uint16_t id() const { return m_id; }
+        const std::string& name() const;
+
+        constexpr bool operator==(const Key& rhs) const { return m_id == rhs.m_id; }
+        constexpr bool operator!=(const Key& rhs) const { return m_id != rhs.m_id; }
+
+      private:
+        static constexpr std::uint16_t NONE{ 0xffff };
+
+        std::uint16_t m_id;
+    };
+
+    constexpr std::string_view FIXED_NAMES[] = {
+        "font/title",
+        "font/menu",
+        "font/credits",
+        "font/game-status",
+        "font/settings",
+        "font/level-select",
+        "font/gameplay",
+        "image/menu-background",
+        "audio/menu-activate",
+        "audio/menu-accept",
+        "image/player",
+        "image/bullet",
+        "image/bomb",
+        "image/sars-cov2",
+        "image/sars-cov2-particle",
+        "image/player-particle",
+        "image/powerup-rapid-fire",
+        "image/powerup-spread-fire",
+        "image/powerup-bomb",
+        "image/player-start-particle",
+        "audio/virus-death",
+        "audio/player-death",
+        "audio/player-start",
+        "audio/thrust",
+        "audio/fire",
+        "audio/bomb-fire",
+        "audio/bomb-explode",
+        "audio/powerup-rapid-fire",
+        "audio/powerup-spread-fire",
+        "audio/powerup-bomb",
+    };
+
+    // Only ever evaluated at compile time, an unknown name fails to compile
+    constexpr Key fixed(std::string_view name)
+    {
+        for (std::uint16_t id = 0; id < std::size(FIXED_NAMES); id++)
+        {
+            if (FIXED_NAMES[id] == name)
+            {
+                return Key(id);
+            }
+        }
+        throw std::logic_error("not one of the fixed content names");
+    }
+
+    constexpr Key KEY_FONT_TITLE = fixed("font/title");
+    constexpr Key KEY_FONT_MENU = fixed("font/menu");
+    constexpr Key KEY_FONT_CREDITS = fixed("font/credits");
+    constexpr Key KEY_FONT_GAME_STATUS = fixed("font/game-status");
+    constexpr Key KEY_FONT_SETTINGS = fixed("font/settings");
+    constexpr Key KEY_FONT_LEVEL_SELECT = fixed("font/level-select");
+    constexpr Key KEY_FONT_GAMEPLAY = fixed("font/gameplay");
+
+    constexpr Key KEY_IMAGE_MENU_BACKGROUND = fixed("image/menu-background");
+
+    constexpr Key KEY_MENU_ACTIVATE = fixed("audio/menu-activate");
+    constexpr Key KEY_MENU_ACCEPT = fixed("audio/menu-accept");
+
+    constexpr Key KEY_IMAGE_PLAYER = fixed("image/player");
+    constexpr Key KEY_IMAGE_BASIC_GUN_BULLET = fixed("image/bullet");
+    constexpr Key KEY_IMAGE_BOMB = fixed("image/bomb");
+    constexpr Key KEY_IMAGE_SARSCOV2 = fixed("image/sars-cov2");
+    constexpr Key KEY_IMAGE_SARSCOV2_PARTICLE = fixed("image/sars-cov2-particle");
+    constexpr Key KEY_IMAGE_PLAYER_PARTICLE = fixed("image/player-particle");
+    constexpr Key KEY_IMAGE_POWERUP_RAPID_FIRE = fixed("image/powerup-rapid-fire");
+    constexpr Key KEY_IMAGE_POWERUP_SPREAD_FIRE = fixed("image/powerup-spread-fire");
+    constexpr Key KEY_IMAGE_POWERUP_BOMB = fixed("image/powerup-bomb");
+    constexpr Key KEY_IMAGE_PLAYER_START_PARTICLE = fixed("image/player-start-particle");
+
+    constexpr Key KEY_AUDIO_VIRUS_DEATH = fixed("audio/virus-death");
+    constexpr Key KEY_AUDIO_PLAYER_DEATH = fixed("audio/player-death");
+    constexpr Key KEY_AUDIO_PLAYER_START = fixed("audio/player-start");
+    constexpr Key KEY_AUDIO_THRUST = fixed("audio/thrust");
+    constexpr Key KEY_AUDIO_BASIC_GUN_FIRE = fixed("audio/fire");
+    constexpr Key KEY_AUDIO_RAPID_GUN_FIRE = fixed("audio/fire");
+    constexpr Key KEY_AUDIO_SPREAD_GUN_FIRE = fixed("audio/fire");
+    constexpr Key KEY_AUDIO_BOMB_FIRE = fixed("audio/bomb-fire");
+    constexpr Key KEY_AUDIO_BOMB_EXPLODE = fixed("audio/bomb-explode");
+    constexpr Key KEY_AUDIO_RAPID_GUN_POWERUP = fixed("audio/powerup-rapid-fire");
+    constexpr Key KEY_AUDIO_SPREAD_GUN_POWERUP = fixed("audio/powerup-spread-fire");
+    constexpr Key KEY_AUDIO_BOMB_POWERUP = fixed("audio/powerup-bomb");
 } // namespace content
@@ -0,0 +1,218 @@
+/*
+Copyright (c) 2021 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "services/DecodedCache.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+// --------------------------------------------------------------
+//
+// Creates the cache folder if it doesn't already exist.  If it can't
+// be created the cache is simply disabled.
+//
+// --------------------------------------------------------------
+bool DecodedCache::initialize(std::filesystem::path folder)
+{
+    std::error_code error;
+    std::filesystem::create_directories(folder, error);
+    m_folder = folder;
+    m_enabled = !error;
+
+    return m_enabled;
+}
+
+bool DecodedCache::load(const Source& source, sf::Image& image) const
+{
+    Header header;
+    std::string pixels;
+    if (!read(source, Type::Image, header, pixels))
+    {
+        return false;
+    }
+    image.create(header.width, header.height, reinterpret_cast<const sf::Uint8*>(pixels.data()));
+
+    return true;
+}
+
+bool DecodedCache::load(const Source& source, sf::SoundBuffer& audio) const
+{
+    Header header;
+    std::string samples;
+    if (!read(source, Type::Audio, header, samples))
+    {
+        return false;
+    }
+
+    return audio.loadFromSamples(reinterpret_cast<const sf::Int16*>(samples.data()), samples.size() / sizeof(sf::Int16), header.width, header.height);
+}
+
+void DecodedCache::save(const Source& source, const sf::Image& image) const
+{
+    Header header{};
+    header.type = Type::Image;
+    header.width = image.getSize().x;
+    header.height = image.getSize().y;
+    header.dataSize = static_cast<std::uint64_t>(header.width) * header.height * 4;
+    write(source, header, image.getPixelsPtr());
+}
+
+void DecodedCache::save(const Source& source, const sf::SoundBuffer& audio) const
+{
+    Header header{};
+    header.type = Type::Audio;
+    header.width = audio.getChannelCount();
+    header.height = audio.getSampleRate();
+    header.dataSize = audio.getSampleCount() * sizeof(sf::Int16);
+    write(source, header, audio.getSamples());
+}
+
+// --------------------------------------------------------------
+//
+// Cache files are named by a 64 bit FNV-1a hash of the asset name.
+//
+// --------------------------------------------------------------
+std::filesystem::path DecodedCache::pathOf(const Source& source) const
+{
+    std::uint64_t hash{ 0xcbf29ce484222325 };
+    for (auto c : source.name)
+    {
+        hash = (hash ^ static_cast<std::uint8_t>(c)) * 0x100000001b3;
+    }
+
+    std::ostringstream name;
+    name << std::hex << std::setw(16) << std::setfill('0') << hash << ".bin";
+
+    return m_folder / name.str();
+}
+
+// --------------------------------------------------------------
+//
+// Reads the cache entry for the source, only if it was decoded from
+// the same version of the source as is on disk now.
+//
+// The header is checked against the length of the file and the shape
+// of the data before anything is allocated for it, so a corrupt or
+// truncated entry is a cache miss rather than a huge allocation.
+//
+// --------------------------------------------------------------
+bool DecodedCache::read(const Source& source, Type type, Header& header, std::string& data) const
+{
+    if (!m_enabled)
+    {
+        return false;
+    }
+
+    auto path = pathOf(source);
+    std::error_code error;
+    auto fileSize = std::filesystem::file_size(path, error);
+    if (error || fileSize < sizeof(Header))
+    {
+        return false;
+    }
+
+    std::ifstream in(path, std::ios::binary);
+    if (!in || !in.read(reinterpret_cast<char*>(&header), sizeof(Header)))
+    {
+        return false;
+    }
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION || header.type != type)
+    {
+        return false;
+    }
+    if (header.timestamp != source.timestamp || header.size != source.size)
+    {
+        return false;
+    }
+    if (header.dataSize != fileSize - sizeof(Header))
+    {
+        return false;
+    }
+    switch (header.type)
+    {
+        case Type::Image:
+            if (header.dataSize % 4 != 0 || header.dataSize / 4 != static_cast<std::uint64_t>(header.width) * header.height)
+            {
+                return false;
+            }
+            break;
+        case Type::Audio:
+            if (header.dataSize % sizeof(sf::Int16) != 0 || header.width == 0 || header.height == 0)
+            {
+                return false;
+            }
+            break;
+    }
+
+    data.resize(static_cast<std::size_t>(header.dataSize));
+    return static_cast<bool>(in.read(data.data(), data.size()));
+}
+
+// --------------------------------------------------------------
+//
+// Several loader threads may write at the same time, so each entry
+// is written to a temporary file that is then renamed into place.
+// A failure here only means the next launch decodes it again.
+//
+// --------------------------------------------------------------
+void DecodedCache::write(const Source& source, Header header, const void* data) const
+{
+    if (!m_enabled || data == nullptr)
+    {
+        return;
+    }
+
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.timestamp = source.timestamp;
+    header.size = source.size;
+
+    auto path = pathOf(source);
+    std::ostringstream suffix;
+    suffix << ".tmp" << std::this_thread::get_id();
+    auto temporary = path;
+    temporary += suffix.str();
+    {
+        std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+        out.write(static_cast<const char*>(data), static_cast<std::streamsize>(header.dataSize));
+        if (!out)
+        {
+            std::cout << "unable to cache: " << source.name << std::endl;
+            out.close();
+            std::error_code error;
+            std::filesystem::remove(temporary, error);
+            return;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(temporary, path, error);
+    if (error)
+    {
+        std::filesystem::remove(temporary, error);
+    }
+}
@@ -0,0 +1,89 @@
+/*
+Copyright (c) 2021 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <SFML/Audio/SoundBuffer.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+// --------------------------------------------------------------
+//
+// On-disk cache of decoded content: RGBA pixels for images and PCM
+// samples for audio clips.  Loading from the cache skips the PNG/JPG
+// and OGG/WAV decoders entirely, the raw buffers are handed straight
+// to the SFML.
+//
+// Each cache file is named by a hash of the source asset name, and
+// records the timestamp and size of the source it was decoded from.
+// An entry whose source has since changed is ignored and rewritten
+// the next time the asset is decoded.
+//
+// --------------------------------------------------------------
+class DecodedCache
+{
+  public:
+    struct Source
+    {
+        std::string name;        // e.g. "images/petri-1.png"
+        std::int64_t timestamp;  // Last write time of the file the asset came from
+        std::uint64_t size;
+    };
+
+    bool initialize(std::filesystem::path folder);
+
+    bool load(const Source& source, sf::Image& image) const;
+    bool load(const Source& source, sf::SoundBuffer& audio) const;
+    void save(const Source& source, const sf::Image& image) const;
+    void save(const Source& source, const sf::SoundBuffer& audio) const;
+
+  private:
+    static constexpr char MAGIC[8]{ 'N', 'A', 'N', 'O', 'D', 'E', 'C', '\0' };
+    static constexpr std::uint32_t VERSION{ 1 };
+
+    enum class Type : std::uint32_t
+    {
+        Image,
+        Audio
+    };
+
+    struct Header
+    {
+        char magic[8];
+        std::uint32_t version;
+        Type type;
+        std::int64_t timestamp;
+        std::uint64_t size;
+        std::uint64_t dataSize;
+        std::uint32_t width;        // Or channel count for audio
+        std::uint32_t height;       // Or sample rate for audio
+    };
+
+    std::filesystem::path m_folder;
+    bool m_enabled{ false };
+
+    std::filesystem::path pathOf(const Source& source) const;
+    bool read(const Source& source, Type type, Header& header, std::string& data) const;
+    void write(const Source& source, Header header, const void* data) const;
+};
@@ -22,9 +22,49 @@ THE SOFTWARE.
 
 #include "services/SoundPlayer.hpp"
 
+#include "services/Configuration.hpp"
+#include "services/ConfigurationPath.hpp"
 #include "services/Content.hpp"
 #include "services/ContentKey.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+namespace
+{
+    // --------------------------------------------------------------
+    //
+    // How many voices each clip may use at once, and how important it is
+    // when voices run out.  Clips not listed here get DEFAULT_CLIP.  The
+    // sounds that can pile up during a bomb chain reaction (virus deaths,
+    // gun fire) are kept low, so they can't crowd out everything else.
+    //
+    // --------------------------------------------------------------
+    struct ClipLimit
+    {
+        content::Key key;
+        std::uint8_t maxVoices;
+        SoundPlayer::Priority priority;
+    };
+
+    constexpr ClipLimit DEFAULT_CLIP{ content::Key(), 4, SoundPlayer::Priority::Normal };
+
+    constexpr ClipLimit CLIP_LIMITS[] = {
+        { content::KEY_MENU_ACTIVATE, 2, SoundPlayer::Priority::High },
+        { content::KEY_MENU_ACCEPT, 1, SoundPlayer::Priority::High },
+        { content::KEY_AUDIO_PLAYER_START, 1, SoundPlayer::Priority::High },
+        { content::KEY_AUDIO_PLAYER_DEATH, 1, SoundPlayer::Priority::High },
+        { content::KEY_AUDIO_BOMB_FIRE, 2, SoundPlayer::Priority::Normal },
+        { content::KEY_AUDIO_BOMB_EXPLODE, 2, SoundPlayer::Priority::Normal },
+        { content::KEY_AUDIO_RAPID_GUN_POWERUP, 1, SoundPlayer::Priority::Normal },
+        { content::KEY_AUDIO_SPREAD_GUN_POWERUP, 1, SoundPlayer::Priority::Normal },
+        { content::KEY_AUDIO_BOMB_POWERUP, 1, SoundPlayer::Priority::Normal },
+        { content::KEY_AUDIO_BASIC_GUN_FIRE, 3, SoundPlayer::Priority::Low }, // All of the guns share the same clip
+        { content::KEY_AUDIO_VIRUS_DEATH, 4, SoundPlayer::Priority::Low },
+    };
+} // namespace
+
 // --------------------------------------------------------------
 //
 // Call this one time at program startup.  This gets the worker
@@ -33,13 +73,20 @@ THE SOFTWARE.
 // --------------------------------------------------------------
 void SoundPlayer::initialize()
 {
-    m_thread = std::make_unique<std::thread>(&SoundPlayer::run, this);
     //
-    // Create a queue of 100 sf::Sound object that we'll cycle through.
-    while (m_sounds.size() < 100)
+    // Only the fixed content keys have limits, so that is as large as the table needs to be
+    m_clips.assign(std::size(content::FIXED_NAMES), { DEFAULT_CLIP.maxVoices, DEFAULT_CLIP.priority });
+    for (auto&& limit : CLIP_LIMITS)
     {
-        m_sounds.enqueue(std::make_shared<sf::Sound>());
+        m_clips[limit.key.id()] = { limit.maxVoices, limit.priority };
     }
+
+    m_coalesceWindow = std::chrono::milliseconds(Configuration::get<std::uint16_t>(config::AUDIO_COALESCE_WINDOW));
+    m_coalesceGain = std::clamp(Configuration::get<float>(config::AUDIO_COALESCE_VOLUME), 0.0f, 100.0f) / 100.0f;
+    m_pending.assign(std::size(content::FIXED_NAMES), {});
+    m_pendingIds.reserve(m_pending.size());
+
+    m_thread = std::make_unique<std::thread>(&SoundPlayer::run, this);
 }
 
 // --------------------------------------------------------------
@@ -51,45 +98,197 @@ void SoundPlayer::initialize()
 void SoundPlayer::terminate()
 {
     m_done = true;
-    m_eventTasks.notify_one();
+    m_tasks.wakeAll();
     m_thread->join();
+
+    for (auto&& voice : m_voices)
+    {
+        voice.sound.stop();
+        voice.sound.resetBuffer();
+        voice.buffer = nullptr;
+    }
+}
+
+// --------------------------------------------------------------
+//
+// Public method to allow client code to initiate a sound.  The first
+// request for a clip is sent to the worker right away and starts its
+// coalesce window; repeats within the window are held until update,
+// merged with each other.  Only the fixed content keys are merged, any
+// other sound is always sent right away.
+//
+// --------------------------------------------------------------
+void SoundPlayer::play(content::Key key, float volume)
+{
+    auto& player = instance();
+    if (key.id() >= player.m_pending.size())
+    {
+        player.enqueue(key, volume);
+        return;
+    }
+
+    auto& pending = player.m_pending[key.id()];
+    if (!pending.open)
+    {
+        player.enqueue(key, volume);
+        pending.open = true;
+        pending.first = player.m_now;
+        pending.count = 0;
+        player.m_pendingIds.push_back(key.id());
+        return;
+    }
+
+    pending.volume = (pending.count == 0) ? volume : std::max(pending.volume, volume);
+    pending.count++;
+}
+
+// --------------------------------------------------------------
+//
+// Called once each pass through the game loop, closes each coalesce
+// window that has passed.  If there were repeats in it, they are sent
+// to the worker as one sound and a new window is started, so a steady
+// stream of the same sound is still merged.  Identical sounds played
+// together add up to about the square root of their count in loudness,
+// so the merged sound is made that much louder, starting from the
+// coalesce volume and capped at full volume.
+//
+// --------------------------------------------------------------
+void SoundPlayer::update(const std::chrono::microseconds elapsedTime)
+{
+    m_now += elapsedTime;
+
+    std::size_t remaining = 0;
+    for (auto id : m_pendingIds)
+    {
+        auto& pending = m_pending[id];
+        if (m_now - pending.first < m_coalesceWindow)
+        {
+            m_pendingIds[remaining++] = id;
+        }
+        else if (pending.count > 0)
+        {
+            enqueue(content::Key(id), std::min(100.0f, pending.volume * m_coalesceGain * std::sqrt(static_cast<float>(pending.count))));
+            pending.first = m_now;
+            pending.count = 0;
+            m_pendingIds[remaining++] = id;
+        }
+        else
+        {
+            pending.open = false;
+        }
+    }
+    m_pendingIds.resize(remaining);
 }
 
 // --------------------------------------------------------------
 //
-// Public method to allow client code to initiate a sound.
+// Hands the sound to the worker thread.  If the queue is full, the
+// sound is dropped, there are already far more sounds waiting than
+// there are voices to play them.
 //
 // --------------------------------------------------------------
-void SoundPlayer::play(const std::string& key, float volume)
+void SoundPlayer::enqueue(content::Key key, float volume)
 {
-    instance().m_tasks.enqueue({ key, volume });
-    instance().m_eventTasks.notify_one();
+    m_tasks.enqueue({ key, volume });
 }
 
 // --------------------------------------------------------------
 //
-// This is the worker thread.  It pulls tasks from the queue and
-// completes them.  If there are no tasks, it goes into an efficient
-// wait state until a new task is added.
+// This is the worker thread.  It takes all of the tasks waiting in
+// the queue at once and completes them.  If there are no tasks, it
+// goes into an efficient wait state until a new task is added.
 //
 // --------------------------------------------------------------
 void SoundPlayer::run()
 {
+    std::array<Task, MAX_VOICES> tasks;
     while (!m_done)
     {
-        auto task = m_tasks.dequeue();
-        if (task.has_value())
+        auto howMany = m_tasks.dequeueBulk(tasks.begin(), tasks.size());
+        for (std::size_t task = 0; task < howMany; task++)
         {
-            auto sound = m_sounds.dequeue().value();
-            sound->setBuffer(*Content::get<sf::SoundBuffer>(task.value().key));
-            sound->setVolume(task.value().volume);
-            sound->play();
-            m_sounds.enqueue(sound);
+            start(tasks[task]);
         }
-        else
+
+        if (howMany == 0)
+        {
+            if (auto task = m_tasks.waitDequeue(m_done); task.has_value())
+            {
+                start(task.value());
+            }
+        }
+    }
+}
+
+// --------------------------------------------------------------
+//
+// Chooses the voice for the sound and starts it playing.  In one pass
+// over the voices, finds the first one not playing, the oldest voice
+// already playing this clip, and the oldest voice of the lowest
+// priority that this sound is allowed to take over.
+//
+// --------------------------------------------------------------
+void SoundPlayer::start(const Task& task)
+{
+    auto& clip = getClip(task.key);
+
+    Voice* available = nullptr;
+    Voice* oldestSame = nullptr;
+    Voice* steal = nullptr;
+    std::uint8_t playing = 0;
+    for (auto&& voice : m_voices)
+    {
+        if (voice.sound.getStatus() == sf::Sound::Stopped)
+        {
+            if (available == nullptr)
+            {
+                available = &voice;
+            }
+            continue;
+        }
+        if (voice.key == task.key)
+        {
+            playing++;
+            if (oldestSame == nullptr || voice.started < oldestSame->started)
+            {
+                oldestSame = &voice;
+            }
+        }
+        if (voice.priority <= clip.priority &&
+            (steal == nullptr || voice.priority < steal->priority || (voice.priority == steal->priority && voice.started < steal->started)))
         {
-            std::unique_lock<std::mutex> lock(m_mutexTasks);
-            m_eventTasks.wait(lock);
+            steal = &voice;
         }
     }
-}
\ No newline at end of file
+
+    auto voice = (playing >= clip.maxVoices) ? oldestSame : (available != nullptr ? available : steal);
+    if (voice == nullptr)
+    {
+        // Every voice is playing something more important
+        return;
+    }
+    auto buffer = Content::get<sf::SoundBuffer>(task.key);
+    if (buffer == nullptr)
+    {
+        return;
+    }
+
+    voice->sound.stop();
+    if (buffer != voice->buffer)
+    {
+        voice->sound.setBuffer(*buffer);
+        voice->buffer = buffer;
+    }
+    voice->key = task.key;
+    voice->priority = clip.priority;
+    voice->started = m_started++;
+    voice->sound.setVolume(task.volume);
+    voice->sound.play();
+}
+
+const SoundPlayer::Clip& SoundPlayer::getClip(content::Key key)
+{
+    static const Clip defaultClip{ DEFAULT_CLIP.maxVoices, DEFAULT_CLIP.priority };
+
+    return key.id() < m_clips.size() ? m_clips[key.id()] : defaultClip;
+}
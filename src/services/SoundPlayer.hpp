@@ -23,16 +23,20 @@ THE SOFTWARE.
 #pragma once
 
 #include "misc/ConcurrentQueue.hpp"
+#include "services/ContentKey.hpp"
 
 #include <SFML/Audio/Music.hpp>
 #include <SFML/Audio/Sound.hpp>
 #include <SFML/Audio/SoundBuffer.hpp>
-#include <condition_variable>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <functional>
 #include <memory>
-#include <mutex>
 #include <string>
 #include <thread>
+#include <vector>
 
 // --------------------------------------------------------------
 //
@@ -48,12 +52,37 @@ THE SOFTWARE.
 // like everything is called a manager.  In the end, I went with
 // SoundPlayer, not great, but workable.
 //
+// Requests to play a sound are handed to the worker thread through
+// a lock-free queue, so play never blocks the game loop; it must only
+// be called from the game loop thread.  The worker plays each sound
+// on one of a fixed set of voices.  Each clip has a limit on how many
+// voices it may use at once, and a priority.  When a clip is at its
+// limit, its oldest voice is restarted.  When every voice is in use,
+// the oldest voice of the lowest priority (no higher than the new
+// sound's) is taken over; if there isn't one, the sound isn't played.
+//
+// Before any of that, the first request for a clip is sent to the
+// worker right away, and any repeats of it within the coalesce window
+// are merged into one, played a little louder, so a burst of identical
+// sounds (a bomb killing a dozen viruses in one update) is only sent to
+// the worker twice.  The merged repeats are sent by update, once the
+// window has passed.  Only the merged sound is scaled, by the configured
+// coalesce volume, which leaves it the headroom to grow louder with the
+// number of repeats; every other sound plays at the volume asked for.
+//
 // Note: This is a Singleton
 //
 // --------------------------------------------------------------
 class SoundPlayer
 {
   public:
+    enum class Priority : std::uint8_t
+    {
+        Low,
+        Normal,
+        High
+    };
+
     SoundPlayer(const SoundPlayer&) = delete;
     SoundPlayer(SoundPlayer&&) = delete;
     SoundPlayer& operator=(const SoundPlayer&) = delete;
@@ -68,34 +97,74 @@ class SoundPlayer
         return instance;
     }
 
-    static void play(const std::string& key, float volume = 100.0f);
+    static void play(content::Key key, float volume = 100.0f);
+    void update(const std::chrono::microseconds elapsedTime);
 
   private:
     SoundPlayer() {}
 
+    static constexpr std::size_t MAX_VOICES{ 32 };
+    static constexpr std::size_t MAX_TASKS{ 256 };
+
     class Task
     {
       public:
-        Task(std::string key, float volume) :
+        Task() = default;
+        Task(content::Key key, float volume) :
             key(key),
             volume(volume)
         {
         }
 
-        std::string key;
-        float volume;
+        content::Key key;
+        float volume{ 100.0f };
+    };
+
+    // The limit on how many voices a clip may use at once, and how important it is
+    struct Clip
+    {
+        std::uint8_t maxVoices;
+        Priority priority;
     };
 
-    // Storing shared_ptr because if you copy sf::Sound it stops playing, need to keep
-    // the original sf::Sound object around all the time.  Could change it to unique_ptr
-    // with a bunch of std::move I suppose, to improve efficiency.
-    ConcurrentQueue<std::shared_ptr<sf::Sound>> m_sounds;
+    // The voice holds on to its buffer, so the content can't be released
+    // out from under it while it is playing.
+    struct Voice
+    {
+        sf::Sound sound;
+        std::shared_ptr<sf::SoundBuffer> buffer;
+        content::Key key;
+        Priority priority{ Priority::Normal };
+        std::uint64_t started{ 0 }; // Used to tell which voices are the oldest
+    };
 
-    bool m_done{ false };
+    std::atomic_bool m_done{ false };
     std::unique_ptr<std::thread> m_thread;
-    ConcurrentQueue<Task> m_tasks;
-    std::condition_variable m_eventTasks;
-    std::mutex m_mutexTasks;
+    ConcurrentQueue<Task, MAX_TASKS> m_tasks;
+
+    // The repeats of a clip made within the coalesce window of its first request
+    struct Pending
+    {
+        bool open{ false };                   // The clip was played and its window hasn't passed yet
+        float volume{ 0.0f };
+        std::uint16_t count{ 0 };             // Repeats waiting to be merged
+        std::chrono::microseconds first{ 0 }; // When the window started
+    };
+
+    // Only touched by the game loop thread
+    std::chrono::microseconds m_coalesceWindow{ 0 };
+    float m_coalesceGain{ 1.0f };
+    std::chrono::microseconds m_now{ 0 };
+    std::vector<Pending> m_pending;           // Indexed by content key id
+    std::vector<std::uint16_t> m_pendingIds; // The ids of the clips with pending requests
+
+    // Only touched by the worker thread
+    std::array<Voice, MAX_VOICES> m_voices;
+    std::vector<Clip> m_clips; // Indexed by content key id
+    std::uint64_t m_started{ 0 };
 
+    void enqueue(content::Key key, float volume);
     void run();
+    void start(const Task& task);
+    const Clip& getClip(content::Key key);
 };
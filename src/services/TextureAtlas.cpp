@@ -0,0 +1,179 @@
+/*
+Copyright (c) 2021 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "services/TextureAtlas.hpp"
+
+#include <SFML/Graphics/Image.hpp>
+#include <algorithm>
+#include <iostream>
+
+// --------------------------------------------------------------
+//
+// Packs the textures for the keys into a new atlas, replacing any
+// existing one.  Textures are sorted tallest first and placed left to
+// right on shelves, starting a new shelf when a row is full.  Simple,
+// but the gameplay images are close enough in size it wastes very
+// little space.
+//
+// If the atlas was already built from these same textures, it is left
+// as it is.  Frames still waiting on the render thread may be drawing
+// from it, and nothing has changed anyway.
+//
+// Returns false if the atlas couldn't be built, in which case everything
+// continues to draw from its own texture.
+//
+// --------------------------------------------------------------
+bool TextureAtlas::build(const std::vector<content::Key>& keys)
+{
+    if (isBuilt() && keys.size() == m_regions.size() &&
+        std::all_of(keys.begin(), keys.end(), [this](auto& key)
+                    { return Content::has<sf::Texture>(key) && m_regionsByTexture.count(Content::get<sf::Texture>(key).get()) == 1; }))
+    {
+        return true;
+    }
+    clear();
+
+    std::vector<std::tuple<content::Key, std::shared_ptr<sf::Texture>>> items;
+    for (auto&& key : keys)
+    {
+        if (!Content::has<sf::Texture>(key))
+        {
+            std::cout << "texture atlas, texture not loaded: " << key.name() << std::endl;
+            continue;
+        }
+        items.push_back({ key, Content::get<sf::Texture>(key) });
+    }
+    if (items.empty())
+    {
+        return false;
+    }
+    std::sort(items.begin(), items.end(), [](auto& a, auto& b)
+              { return std::get<1>(a)->getSize().y > std::get<1>(b)->getSize().y; });
+
+    //
+    // Pick a (power of two) width that is wide enough for the widest texture and
+    // gives a roughly square atlas.
+    unsigned int area = 0;
+    unsigned int widest = 0;
+    for (auto&& [key, texture] : items)
+    {
+        area += (texture->getSize().x + PADDING) * (texture->getSize().y + PADDING);
+        widest = std::max(widest, texture->getSize().x + PADDING);
+    }
+    unsigned int width = 64;
+    while (width < widest || width * width < area)
+    {
+        width *= 2;
+    }
+
+    //
+    // Place everything on shelves
+    std::vector<sf::IntRect> rects;
+    int x = 0;
+    int y = 0;
+    int shelfHeight = 0;
+    for (auto&& [key, texture] : items)
+    {
+        auto w = static_cast<int>(texture->getSize().x);
+        auto h = static_cast<int>(texture->getSize().y);
+        if (x + w > static_cast<int>(width))
+        {
+            x = 0;
+            y += shelfHeight;
+            shelfHeight = 0;
+        }
+        rects.push_back({ x, y, w, h });
+        x += w + PADDING;
+        shelfHeight = std::max(shelfHeight, h + PADDING);
+    }
+    auto height = static_cast<unsigned int>(y + shelfHeight);
+    if (width > sf::Texture::getMaximumSize() || height > sf::Texture::getMaximumSize())
+    {
+        std::cout << "texture atlas too large: " << width << " x " << height << std::endl;
+        return false;
+    }
+
+    //
+    // Copy the pixels of each texture into the atlas image, then create the texture from it
+    sf::Image image;
+    image.create(width, height, sf::Color::Transparent);
+    for (decltype(items.size()) i = 0; i < items.size(); i++)
+    {
+        image.copy(std::get<1>(items[i])->copyToImage(), rects[i].left, rects[i].top);
+    }
+    auto atlas = std::make_shared<sf::Texture>();
+    if (!atlas->loadFromImage(image))
+    {
+        std::cout << "texture atlas failed to create texture" << std::endl;
+        return false;
+    }
+
+    m_atlas = atlas;
+    for (decltype(items.size()) i = 0; i < items.size(); i++)
+    {
+        m_regions[std::get<0>(items[i]).id()] = rects[i];
+        m_regionsByTexture[std::get<1>(items[i]).get()] = rects[i];
+        m_sources.add(std::get<0>(items[i]));
+    }
+
+    return true;
+}
+
+void TextureAtlas::clear()
+{
+    m_atlas = nullptr;
+    m_regions.clear();
+    m_regionsByTexture.clear();
+    m_sources.clear();
+}
+
+// --------------------------------------------------------------
+//
+// Finds where the texture was packed in the atlas, if it was.
+//
+// --------------------------------------------------------------
+std::optional<TextureAtlas::Region> TextureAtlas::find(const sf::Texture* texture) const
+{
+    if (auto itr = m_regionsByTexture.find(texture); itr != m_regionsByTexture.end())
+    {
+        return Region{ m_atlas.get(), itr->second };
+    }
+
+    return std::nullopt;
+}
+
+// --------------------------------------------------------------
+//
+// Returns the atlas region for the content key, or if it isn't part
+// of the atlas, the whole of its own texture.
+//
+// --------------------------------------------------------------
+TextureAtlas::Region TextureAtlas::get(content::Key key)
+{
+    if (auto itr = instance().m_regions.find(key.id()); itr != instance().m_regions.end())
+    {
+        return { instance().m_atlas.get(), itr->second };
+    }
+
+    auto texture = Content::get<sf::Texture>(key);
+    return { texture.get(), { 0, 0, static_cast<int>(texture->getSize().x), static_cast<int>(texture->getSize().y) } };
+}
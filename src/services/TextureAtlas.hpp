@@ -0,0 +1,88 @@
+/*
+Copyright (c) 2021 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "services/Content.hpp"
+#include "services/ContentKey.hpp"
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <memory>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+// --------------------------------------------------------------
+//
+// Packs a set of already loaded textures into a single atlas texture,
+// so that everything drawn from those textures can share one batch.
+// Regions are found either by the content key or by the original
+// texture (which is what components hold on to).
+//
+// The original textures are left in Content, they are still used
+// for their sizes and by anything not drawn through a batch.  The
+// atlas references them for as long as it is built, so they can't be
+// evicted and their address reused by some other texture, which
+// would then be found as one of the regions.
+//
+// Note: This is a Singleton
+//
+// --------------------------------------------------------------
+class TextureAtlas
+{
+  public:
+    TextureAtlas(const TextureAtlas&) = delete;
+    TextureAtlas(TextureAtlas&&) = delete;
+    TextureAtlas& operator=(const TextureAtlas&) = delete;
+    TextureAtlas& operator=(TextureAtlas&&) = delete;
+
+    static auto& instance()
+    {
+        static TextureAtlas instance;
+        return instance;
+    }
+
+    struct Region
+    {
+        const sf::Texture* texture;
+        sf::IntRect rect;
+    };
+
+    bool build(const std::vector<content::Key>& keys);
+    bool isBuilt() { return m_atlas != nullptr; }
+    void clear();
+
+    std::optional<Region> find(const sf::Texture* texture) const;
+    static Region get(content::Key key);
+
+  private:
+    TextureAtlas() {}
+
+    static const int PADDING = 2; // Transparent pixels between regions, so neighbors don't bleed into each other
+
+    std::shared_ptr<sf::Texture> m_atlas{ nullptr };
+    std::unordered_map<std::uint16_t, sf::IntRect> m_regions; // By content key id
+    std::unordered_map<const sf::Texture*, sf::IntRect> m_regionsByTexture;
+    Content::Group m_sources; // Keeps the packed textures resident
+};
@@ -31,37 +31,61 @@ THE SOFTWARE.
 
 namespace systems
 {
-    void Birth::update(const std::chrono::microseconds elapsedTime)
+    // --------------------------------------------------------------
+    //
+    // Nothing happens until the virus is old enough to give birth,
+    // which may already be the case.
+    //
+    // --------------------------------------------------------------
+    bool Birth::addEntity(std::shared_ptr<entities::Entity> entity)
     {
-        for (auto&& [id, entity] : m_entities)
+        if (!System::addEntity(entity))
         {
-            auto age = entity->getComponent<components::Age>();
-            auto birth = entity->getComponent<components::Birth>();
-
-            birth->update(elapsedTime);
-
-            //
-            // Check to see if it gave birth
-            if (birth->isGestating() && birth->getCurrentGestation() <= std::chrono::microseconds(0))
-            {
-                // Congratulations, a bouncing baby virus!
-                auto parentPosition = entity->getComponent<components::Position>();
-                auto baby = std::make_shared<entities::Virus>();
-                baby->getComponent<components::Position>()->set(parentPosition->get());
-                m_onBirth(baby);
-
-                birth->resetGestation();
-            }
-
-            //
-            // Check to see if a new gestation should begin
-            if (age->get() >= birth->getMinAge() && !birth->isGestating())
-            {
-                auto time = std::chrono::microseconds(static_cast<int>(birth->getDistribution()(m_generator)));
-                time = std::max(birth->getGestationMin(), time);
-                birth->setGestationTime(time);
-            }
+            return false;
         }
+
+        auto id = entity->getId();
+        auto age = entity->getComponent<components::Age>();
+        auto birth = entity->getComponent<components::Birth>();
+        auto untilMature = std::max(birth->getMinAge() - age->get(), std::chrono::microseconds(0));
+
+        m_timers.cancel(m_events[id]);
+        m_events[id] = m_timers.schedule(untilMature, [this, id]()
+                                         { beginGestation(id); });
+
+        return true;
+    }
+
+    void Birth::removeEntity(entities::Entity::IdType entityId)
+    {
+        System::removeEntity(entityId);
+
+        if (auto event = m_events.find(entityId); event != m_events.end())
+        {
+            m_timers.cancel(event->second);
+            m_events.erase(event);
+        }
+    }
+
+    void Birth::beginGestation(entities::Entity::IdType entityId)
+    {
+        auto birth = m_entities[entityId]->getComponent<components::Birth>();
+
+        auto time = std::chrono::microseconds(static_cast<int>(birth->getDistribution()(m_generator)));
+        time = std::max(birth->getGestationMin(), time);
+        m_events[entityId] = m_timers.schedule(time, [this, entityId]()
+                                               { giveBirth(entityId); });
+    }
+
+    void Birth::giveBirth(entities::Entity::IdType entityId)
+    {
+        // Congratulations, a bouncing baby virus!
+        auto parentPosition = m_entities[entityId]->getComponent<components::Position>();
+        auto baby = std::make_shared<entities::Virus>();
+        baby->getComponent<components::Position>()->set(parentPosition->get());
+        m_onBirth(baby);
+
+        beginGestation(entityId);
     }
 
-} // namespace systems
\ No newline at end of file
+} // namespace systems
@@ -25,6 +25,7 @@ THE SOFTWARE.
 #include "System.hpp"
 #include "components/Age.hpp"
 #include "components/Birth.hpp"
+#include "misc/TimingWheel.hpp"
 
 #include <chrono>
 #include <functional>
@@ -34,21 +35,36 @@ THE SOFTWARE.
 
 namespace systems
 {
+    // --------------------------------------------------------------
+    //
+    // A virus begins gestating once it reaches maturity, gives birth
+    // when the gestation completes, and immediately begins the next
+    // one.  Each of those steps is an event on the timing wheel, the
+    // system does no work for a virus between them.
+    //
+    // --------------------------------------------------------------
     class Birth : public System
     {
       public:
-        Birth(std::function<void(std::shared_ptr<entities::Entity>)> onBirth) :
+        Birth(TimingWheel& timers, std::function<void(std::shared_ptr<entities::Entity>)> onBirth) :
             System({ ctti::unnamed_type_id<components::Age>(),
                      ctti::unnamed_type_id<components::Birth>() }),
+            m_timers(timers),
             m_onBirth(onBirth)
         {
         }
 
-        virtual void update(const std::chrono::microseconds elapsedTime) override;
+        virtual bool addEntity(std::shared_ptr<entities::Entity> entity) override;
+        virtual void removeEntity(entities::Entity::IdType entityId) override;
 
       private:
+        TimingWheel& m_timers;
         std::function<void(std::shared_ptr<entities::Entity>)> m_onBirth;
+        std::unordered_map<entities::Entity::IdType, TimingWheel::TimerId> m_events;
         std::random_device m_rd;
         std::mt19937 m_generator;
+
+        void beginGestation(entities::Entity::IdType entityId);
+        void giveBirth(entities::Entity::IdType entityId);
     };
 } // namespace systems
@@ -26,27 +26,50 @@ THE SOFTWARE.
 
 namespace systems
 {
-    void Health::update(const std::chrono::microseconds elapsedTime)
+    bool Health::addEntity(std::shared_ptr<entities::Entity> entity)
     {
-        for (auto&& [id, entity] : m_entities)
+        if (!System::addEntity(entity))
         {
-            auto health = entity->getComponent<components::Health>();
-            health->addElapsedIncrementTime(elapsedTime);
-
-            if (health->getRemainingIncrements() > 0)
-            {
-                auto elapsedIncrementTime = health->getElapsedIncrementTime() + elapsedTime;
-                // Compute how many health increments have occurred since the last update
-                auto increments = static_cast<std::uint8_t>(elapsedIncrementTime / health->getIncrementTime());
-
-                if (increments > 0)
-                {
-                    health->add(increments);
-                    health->subtractRemainingIncrements(increments);
-                    health->subtractElapsedIncrementTime(health->getIncrementTime() * increments);
-                }
-            }
+            return false;
         }
+
+        scheduleIncrement(entity->getId(), entity->getComponent<components::Health>());
+
+        return true;
+    }
+
+    void Health::removeEntity(entities::Entity::IdType entityId)
+    {
+        System::removeEntity(entityId);
+
+        if (auto increment = m_increments.find(entityId); increment != m_increments.end())
+        {
+            m_timers.cancel(increment->second);
+            m_increments.erase(increment);
+        }
+    }
+
+    void Health::scheduleIncrement(entities::Entity::IdType entityId, components::Health* health)
+    {
+        m_timers.cancel(m_increments[entityId]);
+        if (health->getRemainingIncrements() > 0)
+        {
+            m_increments[entityId] = m_timers.schedule(health->getIncrementTime(), [this, entityId]()
+                                                       { onIncrement(entityId); });
+        }
+        else
+        {
+            m_increments.erase(entityId);
+        }
+    }
+
+    void Health::onIncrement(entities::Entity::IdType entityId)
+    {
+        auto health = m_entities[entityId]->getComponent<components::Health>();
+        health->add(1);
+        health->subtractRemainingIncrements(1);
+
+        scheduleIncrement(entityId, health);
     }
 
-} // namespace systems
\ No newline at end of file
+} // namespace systems
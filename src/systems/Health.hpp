@@ -24,25 +24,36 @@ THE SOFTWARE.
 
 #include "System.hpp"
 #include "components/Health.hpp"
+#include "misc/TimingWheel.hpp"
 
-#include <chrono>
+#include <unordered_map>
 
 namespace systems
 {
     // --------------------------------------------------------------
     //
     // Viruses' health increases over time.  The purpose of this system
-    // is to add that health as they age.
+    // is to add that health as they age, one increment per event on
+    // the timing wheel until the increments run out.
     //
     // --------------------------------------------------------------
     class Health : public System
     {
       public:
-        Health() :
-            System({ ctti::unnamed_type_id<components::Health>() })
+        Health(TimingWheel& timers) :
+            System({ ctti::unnamed_type_id<components::Health>() }),
+            m_timers(timers)
         {
         }
 
-        virtual void update(const std::chrono::microseconds elapsedTime) override;
+        virtual bool addEntity(std::shared_ptr<entities::Entity> entity) override;
+        virtual void removeEntity(entities::Entity::IdType entityId) override;
+
+      private:
+        TimingWheel& m_timers;
+        std::unordered_map<entities::Entity::IdType, TimingWheel::TimerId> m_increments;
+
+        void scheduleIncrement(entities::Entity::IdType entityId, components::Health* health);
+        void onIncrement(entities::Entity::IdType entityId);
     };
 } // namespace systems
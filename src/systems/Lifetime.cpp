@@ -26,23 +26,42 @@ THE SOFTWARE.
 
 namespace systems
 {
-    void Lifetime::update(const std::chrono::microseconds elapsedTime)
+    bool Lifetime::addEntity(std::shared_ptr<entities::Entity> entity)
     {
-        std::vector<entities::Entity::IdType> removeThese;
-        for (auto&& [id, entity] : m_entities)
+        if (!System::addEntity(entity))
         {
-            auto lifetime = entity->getComponent<components::Lifetime>();
-            lifetime->update(elapsedTime);
-            if (!lifetime->isAlive())
-            {
-                lifetime->endOfLife();
-                removeThese.push_back(id);
-            }
+            return false;
         }
 
-        for (auto&& id : removeThese)
+        auto id = entity->getId();
+        m_timers.cancel(m_expiry[id]);
+        m_expiry[id] = m_timers.schedule(entity->getComponent<components::Lifetime>()->get(), [this, id]()
+                                         { onExpired(id); });
+
+        return true;
+    }
+
+    void Lifetime::removeEntity(entities::Entity::IdType entityId)
+    {
+        System::removeEntity(entityId);
+
+        if (auto expiry = m_expiry.find(entityId); expiry != m_expiry.end())
         {
-            m_onDeath(id);
+            m_timers.cancel(expiry->second);
+            m_expiry.erase(expiry);
         }
     }
-} // namespace systems
\ No newline at end of file
+
+    // --------------------------------------------------------------
+    //
+    // The entity stays with the system until the game model removes
+    // it, which cancels nothing since the event already fired.
+    //
+    // --------------------------------------------------------------
+    void Lifetime::onExpired(entities::Entity::IdType entityId)
+    {
+        m_entities[entityId]->getComponent<components::Lifetime>()->endOfLife();
+        m_expiry.erase(entityId);
+        m_onDeath(entityId);
+    }
+} // namespace systems
@@ -24,22 +24,38 @@ THE SOFTWARE.
 
 #include "System.hpp"
 #include "components/Lifetime.hpp"
+#include "misc/TimingWheel.hpp"
 
-#include <chrono>
+#include <functional>
+#include <unordered_map>
 
 namespace systems
 {
+    // --------------------------------------------------------------
+    //
+    // Entities with a limited lifetime have an expiry event scheduled
+    // on the timing wheel when they are added; nothing is done for
+    // them frame to frame.
+    //
+    // --------------------------------------------------------------
     class Lifetime : public System
     {
       public:
-        Lifetime(std::function<void(entities::Entity::IdType)> onDeath) :
+        Lifetime(TimingWheel& timers, std::function<void(entities::Entity::IdType)> onDeath) :
             System({ ctti::unnamed_type_id<components::Lifetime>() }),
+            m_timers(timers),
             m_onDeath(onDeath)
         {
         }
-        virtual void update(const std::chrono::microseconds elapsedTime) override;
+
+        virtual bool addEntity(std::shared_ptr<entities::Entity> entity) override;
+        virtual void removeEntity(entities::Entity::IdType entityId) override;
 
       private:
+        TimingWheel& m_timers;
         std::function<void(entities::Entity::IdType)> m_onDeath;
+        std::unordered_map<entities::Entity::IdType, TimingWheel::TimerId> m_expiry;
+
+        void onExpired(entities::Entity::IdType entityId);
     };
 } // namespace systems
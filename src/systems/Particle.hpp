@@ -24,27 +24,29 @@ THE SOFTWARE.
 
 #include "misc/math.hpp"
 
-#include <SFML/Graphics.hpp>
+#include <SFML/Graphics/Texture.hpp>
 #include <chrono>
-#include <memory>
 
 namespace systems
 {
+    // --------------------------------------------------------------
+    //
+    // A particle is only a conveyor of data from an effect to the particle
+    // system.  Once emitted, the particle system copies it into its own
+    // structure-of-arrays storage, the particle instance isn't kept.
+    //
+    // --------------------------------------------------------------
     struct Particle
     {
+        const sf::Texture* texture{ nullptr };
         float alphaStart{ 1.0f };
         float alphaEnd{ 1.0f };
-        float alpha{ 1.0f };
         float sizeStart{ 0.0f };
         float sizeEnd{ 0.0f };
-        float size{ 0.0f };
         math::Point2f center{ 0.0f, 0.0f };
         math::Vector2f direction{ 0.0f, 0.0f };
         float speed{ 0.0f };
-        float rotationRate{ 0.0f };
         float rotation{ 0.0f };
         std::chrono::microseconds lifetime{ 0 };
-        std::chrono::microseconds alive{ 0 };
-        sf::Sprite sprite;
     };
 } // namespace systems
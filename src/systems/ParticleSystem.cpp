@@ -23,7 +23,6 @@ THE SOFTWARE.
 #include "ParticleSystem.hpp"
 
 #include "effects/ParticleEffect.hpp"
-#include "services/Configuration.hpp"
 
 namespace systems
 {
@@ -45,6 +44,39 @@ namespace systems
         updateEffects(elapsedTime);
     }
 
+    // --------------------------------------------------------------
+    //
+    // Copies the particle into the next free slot.  Returns false if
+    // there is no room left for it.
+    //
+    // --------------------------------------------------------------
+    bool ParticleSystem::emit(const Particle& particle)
+    {
+        if (m_particleCount == MAX_PARTICLES)
+        {
+            return false;
+        }
+
+        auto p = m_particleCount++;
+        m_texture[p] = particle.texture;
+        m_centerX[p] = particle.center.x;
+        m_centerY[p] = particle.center.y;
+        m_directionX[p] = particle.direction.x;
+        m_directionY[p] = particle.direction.y;
+        m_speed[p] = particle.speed;
+        m_sizeStart[p] = particle.sizeStart;
+        m_sizeEnd[p] = particle.sizeEnd;
+        m_size[p] = particle.sizeStart;
+        m_alphaStart[p] = particle.alphaStart;
+        m_alphaEnd[p] = particle.alphaEnd;
+        m_alpha[p] = particle.alphaStart;
+        m_rotation[p] = particle.rotation;
+        m_lifetime[p] = particle.lifetime.count();
+        m_alive[p] = 0;
+
+        return true;
+    }
+
     // --------------------------------------------------------------
     //
     // Work through the particles, updating them and discarding those
@@ -54,40 +86,37 @@ namespace systems
     void ParticleSystem::updateParticles(const std::chrono::microseconds& elapsedTime)
     {
         //
-        // Step 1: Update all existing particles
+        // Step 1: Compact the still alive particles to the front, this keeps
+        // them in the order they were emitted, which is also the draw order.
         decltype(ParticleSystem::m_particleCount) keeperCount = 0;
         for (decltype(ParticleSystem::m_particleCount) p = 0; p < m_particleCount; p++)
         {
-            auto particle = std::move(m_inUse[p]);
-            particle->alive += elapsedTime;
-            //
-            // Check to see if it is alive before going to the trouble of doing a full update on the particle
-            if (particle->alive < particle->lifetime)
+            m_alive[p] += elapsedTime.count();
+            if (m_alive[p] < m_lifetime[p])
             {
-                // Update position
-                particle->center.x += (elapsedTime.count() * particle->speed * particle->direction.x);
-                particle->center.y += (elapsedTime.count() * particle->speed * particle->direction.y);
-
-                // Update size
-                particle->size = math::lerp(static_cast<float>(particle->alive.count()), 0.0f, static_cast<float>(particle->lifetime.count()), particle->sizeStart, particle->sizeEnd);
-                if (particle->sizeStart != particle->sizeEnd)
+                if (keeperCount != p)
                 {
-                    particle->sprite.setScale(math::getViewScale(particle->size, particle->sprite.getTexture()));
+                    moveParticle(p, keeperCount);
                 }
-
-                // Update alpha transparency
-                particle->alpha = math::lerp(static_cast<float>(particle->alive.count()), 0.0f, static_cast<float>(particle->lifetime.count()), particle->alphaStart, particle->alphaEnd);
-
-                // Place it back to the in use set of particles
-                m_inUse[keeperCount++] = std::move(particle);
-            }
-            else
-            {
-                // Send it back to the available queue
-                m_available.push_back(std::move(particle));
+                keeperCount++;
             }
         }
         m_particleCount = keeperCount;
+
+        //
+        // Step 2: Update the survivors, each of these loops only touches the arrays it needs
+        auto elapsed = static_cast<float>(elapsedTime.count());
+        for (decltype(ParticleSystem::m_particleCount) p = 0; p < m_particleCount; p++)
+        {
+            m_centerX[p] += elapsed * m_speed[p] * m_directionX[p];
+            m_centerY[p] += elapsed * m_speed[p] * m_directionY[p];
+        }
+        for (decltype(ParticleSystem::m_particleCount) p = 0; p < m_particleCount; p++)
+        {
+            auto t = static_cast<float>(m_alive[p]) / m_lifetime[p];
+            m_size[p] = m_sizeStart[p] + t * (m_sizeEnd[p] - m_sizeStart[p]);
+            m_alpha[p] = m_alphaStart[p] + t * (m_alphaEnd[p] - m_alphaStart[p]);
+        }
     }
 
     // --------------------------------------------------------------
@@ -98,19 +127,12 @@ namespace systems
     // --------------------------------------------------------------
     void ParticleSystem::updateEffects(const std::chrono::microseconds& elapsedTime)
     {
-        //
-        // Step 2: Update active effects
         auto effectCount = m_effects.size();
         while (effectCount-- > 0)
         {
             auto effect = std::move(m_effects.front());
             m_effects.pop_front();
-            effect->update(
-                elapsedTime,
-                [this]()
-                { return getAvailableParticle(); },
-                [this](std::unique_ptr<Particle> p)
-                { this->addParticle(std::move(p)); });
+            effect->update(elapsedTime, *this);
             // Put it back in the queue if its lifetime hasn't expired
             if (effect->getAlive() < effect->getLifetime())
             {
@@ -119,17 +141,48 @@ namespace systems
         }
     }
 
+    // --------------------------------------------------------------
+    //
+    // All storage is allocated up front, after this no memory is
+    // allocated or released by the particle system during game play.
+    //
+    // --------------------------------------------------------------
     void ParticleSystem::preAllocateParticles()
     {
-        while (m_available.size() < MAX_PARTICLES)
-        {
-            m_available.push_back(std::make_unique<Particle>());
-        }
+        m_texture.resize(MAX_PARTICLES, nullptr);
+        m_centerX.resize(MAX_PARTICLES);
+        m_centerY.resize(MAX_PARTICLES);
+        m_directionX.resize(MAX_PARTICLES);
+        m_directionY.resize(MAX_PARTICLES);
+        m_speed.resize(MAX_PARTICLES);
+        m_sizeStart.resize(MAX_PARTICLES);
+        m_sizeEnd.resize(MAX_PARTICLES);
+        m_size.resize(MAX_PARTICLES);
+        m_alphaStart.resize(MAX_PARTICLES);
+        m_alphaEnd.resize(MAX_PARTICLES);
+        m_alpha.resize(MAX_PARTICLES);
+        m_rotation.resize(MAX_PARTICLES);
+        m_lifetime.resize(MAX_PARTICLES);
+        m_alive.resize(MAX_PARTICLES);
     }
 
-    void ParticleSystem::addParticle(std::unique_ptr<Particle> p)
+    void ParticleSystem::moveParticle(std::uint16_t from, std::uint16_t to)
     {
-        m_inUse[m_particleCount++] = std::move(p);
+        m_texture[to] = m_texture[from];
+        m_centerX[to] = m_centerX[from];
+        m_centerY[to] = m_centerY[from];
+        m_directionX[to] = m_directionX[from];
+        m_directionY[to] = m_directionY[from];
+        m_speed[to] = m_speed[from];
+        m_sizeStart[to] = m_sizeStart[from];
+        m_sizeEnd[to] = m_sizeEnd[from];
+        m_size[to] = m_size[from];
+        m_alphaStart[to] = m_alphaStart[from];
+        m_alphaEnd[to] = m_alphaEnd[from];
+        m_alpha[to] = m_alpha[from];
+        m_rotation[to] = m_rotation[from];
+        m_lifetime[to] = m_lifetime[from];
+        m_alive[to] = m_alive[from];
     }
 
-} // namespace systems
\ No newline at end of file
+} // namespace systems
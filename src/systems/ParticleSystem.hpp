@@ -27,11 +27,11 @@ THE SOFTWARE.
 #include "misc/math.hpp"
 
 #include <SFML/Graphics.hpp>
-#include <array>
 #include <chrono>
 #include <cstdint>
 #include <deque>
 #include <memory>
+#include <vector>
 
 namespace systems
 {
@@ -45,6 +45,10 @@ namespace systems
     // The particle system calls into all active effects to have them
     // generate particles.
     //
+    // Particles are stored as a structure of arrays, rather than an array
+    // of particle instances.  The update only touches the few values it
+    // needs for each particle, and those values are contiguous in memory.
+    //
     // --------------------------------------------------------------
     class ParticleSystem // I know it is redundant to put System in the name, but I also need a Particle class, so there!
     {
@@ -53,30 +57,37 @@ namespace systems
 
         void update(const std::chrono::microseconds elapsedTime);
         void addEffect(std::unique_ptr<ParticleEffect> effect) { m_effects.push_back(std::move(effect)); }
+        bool emit(const Particle& particle);
 
       private:
         friend systems::RendererParticleSystem;
 
         static const auto MAX_PARTICLES = 10'000; // NOTE: Purely arbitrary number for now, no specific reason for it.
-        std::deque<std::unique_ptr<Particle>> m_available;
-        std::array<std::unique_ptr<Particle>, MAX_PARTICLES> m_inUse; // This has to be a random access container for the particle system rendering to use and not have to keep removing/adding things to a queue-like container
         std::uint16_t m_particleCount{ 0 };
+
+        //
+        // The particles, one entry per particle in each of these
+        std::vector<const sf::Texture*> m_texture;
+        std::vector<float> m_centerX;
+        std::vector<float> m_centerY;
+        std::vector<float> m_directionX;
+        std::vector<float> m_directionY;
+        std::vector<float> m_speed;
+        std::vector<float> m_sizeStart;
+        std::vector<float> m_sizeEnd;
+        std::vector<float> m_size;
+        std::vector<float> m_alphaStart;
+        std::vector<float> m_alphaEnd;
+        std::vector<float> m_alpha;
+        std::vector<float> m_rotation;
+        std::vector<std::chrono::microseconds::rep> m_lifetime;
+        std::vector<std::chrono::microseconds::rep> m_alive;
+
         std::deque<std::unique_ptr<ParticleEffect>> m_effects;
 
         void updateParticles(const std::chrono::microseconds& elapsedTime);
         void updateEffects(const std::chrono::microseconds& elapsedTime);
-        std::unique_ptr<Particle> getAvailableParticle()
-        {
-            if (!m_available.empty())
-            {
-                // Yuck!
-                auto p = std::move(m_available.front());
-                m_available.pop_front();
-                return p;
-            }
-            return nullptr; // Could return an optional, but I'm fine with nullptr for this.
-        }
         void preAllocateParticles();
-        void addParticle(std::unique_ptr<Particle> p);
+        void moveParticle(std::uint16_t from, std::uint16_t to);
     };
 } // namespace systems
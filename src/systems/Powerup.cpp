@@ -37,38 +37,27 @@ THE SOFTWARE.
 
 namespace systems
 {
-    Powerup::Powerup(levels::Level& level, std::function<void(std::shared_ptr<entities::Powerup>&)> emitPowerup, const std::string levelKey) :
+    Powerup::Powerup(TimingWheel& timers, levels::Level& level, std::function<void(std::shared_ptr<entities::Powerup>&)> emitPowerup, levels::LevelName levelName) :
         System({}),
+        m_timers(timers),
         m_level(level),
         m_emitPowerup(emitPowerup),
         m_generator(m_rd()),
         m_distUniform(0.0f, 1.0f)
     {
-        using namespace std::string_literals;
-        using namespace config;
-
-        const config_path MIN_POWERUP_TIME = { DOM_LEVELS, levelKey, DOM_SETTINGS, "min-powerup-time"s };
-        const config_path BOMB_POWERUP_TIME = { DOM_LEVELS, levelKey, DOM_SETTINGS, "bomb-powerup-time"s };
-        const config_path RAPID_FIRE_POWERUP_TIME = { DOM_LEVELS, levelKey, DOM_SETTINGS, "rapid-fire-powerup-time"s };
-        const config_path SPREAD_FIRE_POWERUP_TIME = { DOM_LEVELS, levelKey, DOM_SETTINGS, "spread-fire-powerup-time"s };
-
-        m_timeMinPowerup = misc::msTous(Configuration::get<std::chrono::milliseconds>(MIN_POWERUP_TIME));
-        m_timeBombPowerup = misc::msTous(Configuration::get<std::chrono::milliseconds>(BOMB_POWERUP_TIME));
-        m_timeRapidFirePowerup = misc::msTous(Configuration::get<std::chrono::milliseconds>(RAPID_FIRE_POWERUP_TIME));
-        m_timeSpreadFirePowerup = misc::msTous(Configuration::get<std::chrono::milliseconds>(SPREAD_FIRE_POWERUP_TIME));
-    }
-
-    // --------------------------------------------------------------
-    //
-    // Only thing done here is to determine if a new powerup should
-    // be created.
-    //
-    // --------------------------------------------------------------
-    void Powerup::update(const std::chrono::microseconds elapsedTime)
-    {
-        updatePowerup<entities::PowerupBomb>(elapsedTime, m_timeBombPowerup, m_nextBombPowerup, m_nextBombPowerupCompute);
-        updatePowerup<entities::PowerupRapidFire>(elapsedTime, m_timeRapidFirePowerup, m_nextRapidFirePowerup, m_nextRapidFirePowerupCompute);
-        updatePowerup<entities::PowerupSpreadFire>(elapsedTime, m_timeSpreadFirePowerup, m_nextSpreadFirePowerup, m_nextSpreadFirePowerupCompute);
+        auto& settings = Configuration::getSnapshot().level(levelName);
+
+        m_timeMinPowerup = settings.minPowerupTime;
+        m_timeBombPowerup = settings.bombPowerupTime;
+        m_timeRapidFirePowerup = settings.rapidFirePowerupTime;
+        m_timeSpreadFirePowerup = settings.spreadFirePowerupTime;
+
+        //
+        // Each powerup type keeps itself going from here, rescheduling its
+        // next decision every time one is made.
+        computePowerup<entities::PowerupBomb>(m_timeBombPowerup, m_nextBombPowerup);
+        computePowerup<entities::PowerupRapidFire>(m_timeRapidFirePowerup, m_nextRapidFirePowerup);
+        computePowerup<entities::PowerupSpreadFire>(m_timeSpreadFirePowerup, m_nextSpreadFirePowerup);
     }
 
 } // namespace systems
@@ -26,6 +26,7 @@ THE SOFTWARE.
 #include "components/Powerup.hpp"
 #include "entities/Powerup.hpp"
 #include "levels/Level.hpp"
+#include "misc/TimingWheel.hpp"
 
 #include <atomic>
 #include <chrono>
@@ -34,12 +35,17 @@ THE SOFTWARE.
 
 namespace systems
 {
+    // --------------------------------------------------------------
+    //
+    // Each powerup type appears once per its time frame, at a random
+    // point within it.  Deciding when and emitting it are both events
+    // on the timing wheel.
+    //
+    // --------------------------------------------------------------
     class Powerup : public System
     {
       public:
-        Powerup(levels::Level& level, std::function<void(std::shared_ptr<entities::Powerup>&)> emitPowerup, const std::string levelKey);
-
-        virtual void update(std::chrono::microseconds elapsedTime) override;
+        Powerup(TimingWheel& timers, levels::Level& level, std::function<void(std::shared_ptr<entities::Powerup>&)> emitPowerup, levels::LevelName levelName);
 
       protected:
         virtual bool isInterested([[maybe_unused]] entities::Entity* entity) override
@@ -48,6 +54,7 @@ namespace systems
         }
 
       private:
+        TimingWheel& m_timers;
         levels::Level& m_level;
         std::function<void(std::shared_ptr<entities::Powerup>&)> m_emitPowerup;
 
@@ -60,44 +67,39 @@ namespace systems
         std::chrono::microseconds m_timeMinPowerup{ 0 };
 
         std::chrono::microseconds m_timeBombPowerup{ 0 };
-        std::chrono::microseconds m_nextBombPowerup{ std::chrono::microseconds::max() };
-        std::chrono::microseconds m_nextBombPowerupCompute{ 0 };
+        TimingWheel::TimerId m_nextBombPowerup{ TimingWheel::INVALID_TIMER };
 
         std::chrono::microseconds m_timeRapidFirePowerup{ 0 };
-        std::chrono::microseconds m_nextRapidFirePowerup{ std::chrono::microseconds::max() };
-        std::chrono::microseconds m_nextRapidFirePowerupCompute{ 0 };
+        TimingWheel::TimerId m_nextRapidFirePowerup{ TimingWheel::INVALID_TIMER };
 
         std::chrono::microseconds m_timeSpreadFirePowerup{ 0 };
-        std::chrono::microseconds m_nextSpreadFirePowerup{ std::chrono::microseconds::max() };
-        std::chrono::microseconds m_nextSpreadFirePowerupCompute{ 0 };
+        TimingWheel::TimerId m_nextSpreadFirePowerup{ TimingWheel::INVALID_TIMER };
 
         template <typename T>
-        void updatePowerup(const std::chrono::microseconds elapsedTime, const std::chrono::microseconds timeFrame, std::chrono::microseconds& timeRemaining, std::chrono::microseconds& nextCompute)
+        void computePowerup(const std::chrono::microseconds timeFrame, TimingWheel::TimerId& nextPowerup)
         {
-            nextCompute -= elapsedTime;
-            if (nextCompute <= std::chrono::microseconds(0))
+            // If the time frame is 0, that means the powerup should never appear
+            if (timeFrame <= std::chrono::microseconds{ 0 })
             {
-                // If the time frame is 0, that means the powerup should never appear
-                if (timeFrame > std::chrono::microseconds{ 0 })
-                {
-                    // We want the powerup to appear once per timeFrame.  Therefore
-                    // compute a uniform random number/time between 0 and timeFrame (ms) and that is when
-                    // it will appear.
-                    timeRemaining = std::chrono::duration_cast<std::chrono::microseconds>(m_distUniform(m_generator) * timeFrame);
-                    timeRemaining = std::max(m_timeMinPowerup, timeRemaining);
-                    // Don't forget to reset the next time a powerup decision should be computed
-                    nextCompute = timeFrame;
-                }
+                return;
             }
 
-            timeRemaining -= elapsedTime;
-            if (timeRemaining <= std::chrono::microseconds(0))
-            {
-                std::shared_ptr<entities::Powerup> powerup = std::make_shared<T>(m_level.computePowerupPosition());
-                m_emitPowerup(powerup);
-                // Setting to a huge number so we don't generate another one until the time is (re)set above
-                timeRemaining = std::chrono::microseconds::max();
-            }
+            // We want the powerup to appear once per timeFrame.  Therefore
+            // compute a uniform random number/time between 0 and timeFrame (ms) and that is when
+            // it will appear.  A powerup from the previous time frame that hasn't appeared yet
+            // (only possible with a min time longer than the frame) is replaced by this one.
+            auto timeRemaining = std::chrono::duration_cast<std::chrono::microseconds>(m_distUniform(m_generator) * timeFrame);
+            timeRemaining = std::max(m_timeMinPowerup, timeRemaining);
+            m_timers.cancel(nextPowerup);
+            nextPowerup = m_timers.schedule(timeRemaining, [this]()
+                                            {
+                                                std::shared_ptr<entities::Powerup> powerup = std::make_shared<T>(m_level.computePowerupPosition());
+                                                m_emitPowerup(powerup);
+                                            });
+
+            // Don't forget to schedule the next time a powerup decision should be computed
+            m_timers.schedule(timeFrame, [this, timeFrame, &nextPowerup]()
+                              { computePowerup<T>(timeFrame, nextPowerup); });
         }
     };
-} // namespace systems
\ No newline at end of file
+} // namespace systems
@@ -27,20 +27,25 @@ THE SOFTWARE.
 
 namespace systems
 {
-    void RendererAnimatedSprite::update([[maybe_unused]] std::chrono::microseconds elapsedTime, sf::RenderTarget& renderTarget)
+    void RendererAnimatedSprite::update([[maybe_unused]] std::chrono::microseconds elapsedTime, renderers::SpriteBatch& batch)
     {
-        // Render each of the entities
+        // Add each of the entities to the batch
         for (auto&& [id, entity] : m_entities)
         {
             (void)id; // unused
 
             auto sprite = entity->getComponent<components::AnimatedSprite>();
-            sprite->getSprite()->setPosition(entity->getComponent<components::Position>()->get());
-
             // The texutre contains multiple images, we only want to draw one of them.
-            sprite->getSprite()->setTextureRect(sprite->getCurrentSpriteRect());
-
-            renderTarget.draw(*sprite->getSprite());
+            auto rect = sprite->getCurrentSpriteRect();
+            // The entity set the scale on the sprite so that one image renders at the correct size
+            auto scale = sprite->getSprite()->getScale();
+
+            batch.add(
+                sprite->getSprite()->getTexture(),
+                rect,
+                entity->getComponent<components::Position>()->get(),
+                { rect.width * scale.x, rect.height * scale.y },
+                sprite->getSprite()->getRotation());
         }
     }
 } // namespace systems
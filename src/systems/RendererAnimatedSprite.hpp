@@ -25,6 +25,7 @@ THE SOFTWARE.
 #include "System.hpp"
 #include "components/AnimatedSprite.hpp"
 #include "components/Position.hpp"
+#include "renderers/SpriteBatch.hpp"
 
 #include <chrono>
 
@@ -32,7 +33,8 @@ namespace systems
 {
     // --------------------------------------------------------------
     //
-    // This system is used to render AnimatedSprites.
+    // This system is used to render AnimatedSprites.  The current frame
+    // of each is added to a sprite batch, same as the RendererSprite.
     //
     // --------------------------------------------------------------
     class RendererAnimatedSprite : public System
@@ -44,6 +46,6 @@ namespace systems
         {
         }
 
-        void update(std::chrono::microseconds elapsedTime, sf::RenderTarget& renderTarget);
+        void update(std::chrono::microseconds elapsedTime, renderers::SpriteBatch& batch);
     };
 } // namespace systems
@@ -31,16 +31,24 @@ namespace systems
     // to everyone else.
     //
     // --------------------------------------------------------------
-    void RendererParticleSystem::update(systems::ParticleSystem& ps, sf::RenderTarget& renderTarget)
+    void RendererParticleSystem::update(systems::ParticleSystem& ps, renderers::RenderFrame& renderTarget)
     {
+        //
+        // Particles are added to a batch rather than drawn one by one; with
+        // their textures in the atlas they all end up as a single draw call.
+        // Particles that have moved off the screen are culled by the batch.
+        m_batch.clear();
+        m_batch.setView(renderTarget.getView());
         for (decltype(ps.m_particleCount) p = 0; p < ps.m_particleCount; p++)
         {
-            auto& particle = ps.m_inUse[p];
-            particle->sprite.setPosition(particle->center);
-            particle->sprite.setRotation(particle->rotation);
-
-            renderTarget.draw(particle->sprite);
+            m_batch.add(
+                ps.m_texture[p],
+                { ps.m_centerX[p], ps.m_centerY[p] },
+                { ps.m_size[p], ps.m_size[p] },
+                ps.m_rotation[p],
+                sf::Color(255, 255, 255, static_cast<sf::Uint8>(ps.m_alpha[p] * 255)));
         }
+        m_batch.render(renderTarget);
     }
 
 } // namespace systems
@@ -23,6 +23,7 @@ THE SOFTWARE.
 #pragma once
 
 #include "System.hpp"
+#include "renderers/SpriteBatch.hpp"
 #include "systems/ParticleSystem.hpp"
 
 #include <SFML/Graphics.hpp>
@@ -38,6 +39,9 @@ namespace systems
     class RendererParticleSystem : public System
     {
       public:
-        void update(systems::ParticleSystem& ps, sf::RenderTarget& renderTarget);
+        void update(systems::ParticleSystem& ps, renderers::RenderFrame& renderTarget);
+
+      private:
+        renderers::SpriteBatch m_batch;
     };
 } // namespace systems
@@ -28,25 +28,18 @@ THE SOFTWARE.
 
 namespace systems
 {
-    void RendererSprite::update([[maybe_unused]] std::chrono::microseconds elapsedTime, sf::RenderTarget& renderTarget)
+    void RendererSprite::update([[maybe_unused]] std::chrono::microseconds elapsedTime, renderers::SpriteBatch& batch)
     {
-        // Render each of the entities
+        // Add each of the entities to the batch
         for (auto&& [id, entity] : m_entities)
         {
             (void)id; // unused
 
-            auto position = entity->getComponent<components::Position>();
-            auto size = entity->getComponent<components::Size>();
-            auto orientation = entity->getComponent<components::Orientation>();
-
-            sf::Sprite sprite(*(entity->getComponent<components::Sprite>()->get()));
-            sprite.setOrigin({ sprite.getTexture()->getSize().x / 2.0f, sprite.getTexture()->getSize().y / 2.0f });
-            sprite.setPosition(position->get());
-            sprite.setRotation(orientation->get());
-
-            sprite.setScale(math::getViewScale(size->get(), sprite.getTexture()));
-
-            renderTarget.draw(sprite);
+            batch.add(
+                entity->getComponent<components::Sprite>()->get().get(),
+                entity->getComponent<components::Position>()->get(),
+                entity->getComponent<components::Size>()->get(),
+                entity->getComponent<components::Orientation>()->get());
         }
     }
 } // namespace systems
@@ -27,6 +27,7 @@ THE SOFTWARE.
 #include "components/Position.hpp"
 #include "components/Size.hpp"
 #include "components/Sprite.hpp"
+#include "renderers/SpriteBatch.hpp"
 
 #include <chrono>
 
@@ -34,7 +35,9 @@ namespace systems
 {
     // --------------------------------------------------------------
     //
-    // This system is used to render Sprites.
+    // This system is used to render Sprites.  Rather than drawing them,
+    // a quad for each is added to a sprite batch, which is drawn once all
+    // sprite-like things have been added to it.
     //
     // --------------------------------------------------------------
     class RendererSprite : public System
@@ -48,6 +51,6 @@ namespace systems
         {
         }
 
-        void update(std::chrono::microseconds elapsedTime, sf::RenderTarget& renderTarget);
+        void update(std::chrono::microseconds elapsedTime, renderers::SpriteBatch& batch);
     };
 } // namespace systems
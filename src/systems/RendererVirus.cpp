@@ -54,20 +54,37 @@ namespace systems
                  ctti::unnamed_type_id<components::Position>(),
                  ctti::unnamed_type_id<components::Size>() })
     {
-        auto texVirus = Content::get<sf::Texture>(content::KEY_IMAGE_SARSCOV2);
-        auto texBullet = Content::get<sf::Texture>(content::KEY_IMAGE_BASIC_GUN_BULLET);
+        m_texVirus = Content::get<sf::Texture>(content::KEY_IMAGE_SARSCOV2);
+        m_texBullet = Content::get<sf::Texture>(content::KEY_IMAGE_BASIC_GUN_BULLET);
 
-        m_sprite = std::make_shared<sf::Sprite>();
-        m_sprite->setTexture(*texVirus);
-        m_sprite->setOrigin({ texVirus->getSize().x / 2.0f, texVirus->getSize().y / 2.0f });
+        m_bulletSize = Configuration::getSnapshot().weapon(config::WeaponName::BasicGun).size;
+        m_bulletRadius = m_bulletSize / 2.0f;
+    }
 
-        m_bullet = std::make_shared<sf::Sprite>();
-        m_bullet->setTexture(*texBullet);
-        m_bullet->setOrigin({ texBullet->getSize().x / 2.0f, texBullet->getSize().y / 2.0f });
+    // --------------------------------------------------------------
+    //
+    // Returns the points evenly spaced around a unit circle for the
+    // number of bullets.  A virus only picks up bullets one at a time,
+    // so there are only ever a few dozen of these tables, each computed
+    // the first time that many bullets are seen.
+    //
+    // --------------------------------------------------------------
+    const std::vector<math::Vector2f>& RendererVirus::getUnitCircle(std::uint16_t howMany)
+    {
+        auto itr = m_unitCircles.find(howMany);
+        if (itr == m_unitCircles.end())
+        {
+            std::vector<math::Vector2f> points;
+            points.reserve(howMany);
+            auto angleDiff = (2.0f * 3.14159f) / howMany;
+            for (decltype(howMany) bullet = 0; bullet < howMany; bullet++)
+            {
+                points.emplace_back(std::cos(bullet * angleDiff), std::sin(bullet * angleDiff));
+            }
+            itr = m_unitCircles.insert({ howMany, std::move(points) }).first;
+        }
 
-        config::config_path WEAPON_ITEM_SIZE = { config::DOM_ENTITY, config::ENTITY_WEAPON_BASIC_GUN, config::DOM_SIZE };
-        m_bulletSize = Configuration::get<float>(WEAPON_ITEM_SIZE);
-        m_bulletRadius = m_bulletSize / 2.0f;
+        return itr->second;
     }
 
     // --------------------------------------------------------------
@@ -77,44 +94,47 @@ namespace systems
     // of the virus.  That is taken care of by grabbing the start angle
     // of the bullets from the virus itself.
     //
+    // The bullet positions come from rotating the unit circle for that
+    // many bullets by the start angle, so only one cos/sin pair is needed
+    // per virus, regardless of how many bullets it has.
+    //
     // --------------------------------------------------------------
-    void RendererVirus::update(std::chrono::microseconds elapsedTime, sf::RenderTarget& renderTarget)
+    void RendererVirus::update(std::chrono::microseconds elapsedTime, renderers::SpriteBatch& batch)
     {
-        // Render each of the entities
         for (auto&& [id, entity] : m_entities)
         {
-            auto position = entity->getComponent<components::Position>();
+            auto position = entity->getComponent<components::Position>()->get();
             auto size = entity->getComponent<components::Size>();
 
-            m_sprite->setPosition(position->get());
-            m_sprite->setRotation(entity->getComponent<components::Orientation>()->get());
-            m_sprite->setScale(math::getViewScale(size->get(), m_sprite->getTexture()));
-
-            renderTarget.draw(*m_sprite);
-
-            //
-            // Now, render any bullets attached to this virus.
-            // TODO: U G L Y, get this fixed soon!
-            //auto virus = static_cast<entities::Virus*>(&(*entity));
             auto bullets = entity->getComponent<components::Bullets>();
+            auto angle = math::toRadians(bullets->getBulletAngleStart());
+            // Without bullets there is no ring, leaving its phase where it is
             if (bullets->howMany() > 0)
             {
-                auto angle = math::toRadians(bullets->getBulletAngleStart());
                 bullets->updateBulletAngleStart(elapsedTime);
-                // Evenly place them around the virus
-                auto angleDiff = (2.0f * 3.14159f) / bullets->howMany();
-                auto radius = size->getInnerRadius();
-                for (decltype(bullets->howMany()) bullet = 0; bullet < bullets->howMany(); bullet++)
-                {
-                    auto x = position->get().x + (radius + m_bulletRadius) * std::cos(angle);
-                    auto y = position->get().y + (radius + m_bulletRadius) * std::sin(angle);
-                    angle += angleDiff;
+            }
 
-                    m_bullet->setPosition({ x, y });
-                    m_bullet->setRotation(0.0f);
-                    m_bullet->setScale(math::getViewScale(m_bulletSize, m_bullet->getTexture()));
+            //
+            // The virus and its ring of bullets are culled together, none of the
+            // bullets can be visible if the circle around all of them isn't.
+            if (!batch.isVisible(position, size->getOuterRadius() + m_bulletSize))
+            {
+                continue;
+            }
+
+            batch.add(m_texVirus.get(), position, size->get(), entity->getComponent<components::Orientation>()->get());
+
+            if (bullets->howMany() > 0)
+            {
+                auto radius = size->getInnerRadius() + m_bulletRadius;
+                auto cosStart = radius * std::cos(angle);
+                auto sinStart = radius * std::sin(angle);
+                for (auto&& point : getUnitCircle(bullets->howMany()))
+                {
+                    auto x = position.x + point.x * cosStart - point.y * sinStart;
+                    auto y = position.y + point.x * sinStart + point.y * cosStart;
 
-                    renderTarget.draw(*m_bullet);
+                    batch.add(m_texBullet.get(), { x, y }, { m_bulletSize, m_bulletSize }, 0.0f);
                 }
             }
         }
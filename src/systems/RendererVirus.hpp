@@ -23,16 +23,24 @@ THE SOFTWARE.
 #pragma once
 
 #include "System.hpp"
+#include "misc/math.hpp"
+#include "renderers/SpriteBatch.hpp"
 
 #include <SFML/Graphics.hpp>
+#include <chrono>
+#include <cstdint>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 
 namespace systems
 {
     // --------------------------------------------------------------
     //
     // This system knows how to render a virus and however many
-    // bullets have surrounded it.
+    // bullets have surrounded it.  Both are added to a sprite batch,
+    // which (with the texture atlas) lets the viruses, their bullets,
+    // and everything else be drawn together.
     //
     // --------------------------------------------------------------
     class RendererVirus : public System
@@ -40,14 +48,19 @@ namespace systems
       public:
         RendererVirus();
 
-        void update(std::chrono::microseconds elapsedTime, sf::RenderTarget& renderTarget);
+        void update(std::chrono::microseconds elapsedTime, renderers::SpriteBatch& batch);
 
       private:
-        std::shared_ptr<sf::Sprite> m_sprite;
-        std::shared_ptr<sf::Sprite> m_bullet;
+        std::shared_ptr<sf::Texture> m_texVirus;
+        std::shared_ptr<sf::Texture> m_texBullet;
 
         float m_bulletSize{ 0 };
         float m_bulletRadius{ 0 };
+
+        // Evenly spaced points around a unit circle, one table per bullet count
+        std::unordered_map<std::uint16_t, std::vector<math::Vector2f>> m_unitCircles;
+
+        const std::vector<math::Vector2f>& getUnitCircle(std::uint16_t howMany);
     };
 
 } // namespace systems
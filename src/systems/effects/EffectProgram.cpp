@@ -0,0 +1,151 @@
+/*
+Copyright (c) 2021 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "EffectProgram.hpp"
+
+#include "services/Configuration.hpp"
+#include "services/ConfigurationPath.hpp"
+#include "services/Content.hpp"
+
+#include <iostream>
+#include <unordered_map>
+
+namespace systems
+{
+    // --------------------------------------------------------------
+    //
+    // Turns a parameter name from the configuration into its enum value.
+    //
+    // --------------------------------------------------------------
+    EffectParameter compileParameter(const std::string& name)
+    {
+        static const std::unordered_map<std::string, EffectParameter> parameters = {
+            { "bullets", EffectParameter::Bullets },
+            { "inner-radius", EffectParameter::InnerRadius },
+            { "outer-radius", EffectParameter::OuterRadius },
+            { "bullet-size", EffectParameter::BulletSize },
+            { "orientation", EffectParameter::Orientation }
+        };
+
+        if (auto itr = parameters.find(name); itr != parameters.end())
+        {
+            return itr->second;
+        }
+        std::cout << "unknown effect parameter: " << name << std::endl;
+        return EffectParameter::None;
+    }
+
+    // --------------------------------------------------------------
+    //
+    // An operand is made from up to three settings, e.g., for "distance"...
+    //   "distance"       : the value (defaults to 0 if not present)
+    //   "distance-scale" : name of a parameter the value is multiplied by
+    //   "distance-stdev" : standard deviation, when present the value is the mean
+    //
+    // --------------------------------------------------------------
+    EffectOperand compileOperand(const config::config_path& emitter, const std::string& name)
+    {
+        auto path = [&emitter](const std::string& setting)
+        {
+            auto path = emitter;
+            path.push_back(setting);
+            return path;
+        };
+
+        EffectOperand operand;
+        if (Configuration::has(path(name)))
+        {
+            operand.value = Configuration::get<float>(path(name));
+        }
+        if (Configuration::has(path(name + config::DOM_SCALE_SUFFIX)))
+        {
+            operand.scaleBy = compileParameter(Configuration::get<std::string>(path(name + config::DOM_SCALE_SUFFIX)));
+        }
+        if (Configuration::has(path(name + config::DOM_STDEV_SUFFIX)))
+        {
+            operand.stdev = Configuration::get<float>(path(name + config::DOM_STDEV_SUFFIX));
+        }
+
+        return operand;
+    }
+
+    // --------------------------------------------------------------
+    //
+    // Reads the effect from the configuration and compiles each of its
+    // emitters so that nothing has to be looked up while the game is
+    // running.  The textures referenced by the effect must already be
+    // loaded, so this should be called once content is ready.
+    //
+    // --------------------------------------------------------------
+    std::shared_ptr<EffectProgram> compileEffect(const std::string& name)
+    {
+        auto program = std::make_shared<EffectProgram>();
+
+        config::config_path effect = { config::DOM_EFFECTS, name };
+        if (!Configuration::has(effect))
+        {
+            std::cout << "effect not found: " << name << std::endl;
+            return program;
+        }
+
+        for (auto&& emitterName : Configuration::getMembers(effect))
+        {
+            auto emitter = effect;
+            emitter.push_back(emitterName);
+
+            auto imagePath = emitter;
+            imagePath.push_back(config::DOM_IMAGE);
+            auto image = content::Key(Configuration::get<std::string>(imagePath));
+            if (!Content::has<sf::Texture>(image))
+            {
+                std::cout << "effect " << name << ", emitter " << emitterName << ", image not loaded: " << image.name() << std::endl;
+                continue;
+            }
+
+            EmitterProgram compiled;
+            compiled.texture = Content::get<sf::Texture>(image);
+
+            auto patternPath = emitter;
+            patternPath.push_back(config::DOM_PATTERN);
+            if (Configuration::has(patternPath) && Configuration::get<std::string>(patternPath) == "random")
+            {
+                compiled.pattern = EmitterProgram::Pattern::Random;
+            }
+
+            compiled.count = compileOperand(emitter, config::DOM_COUNT);
+            compiled.distance = compileOperand(emitter, config::DOM_DISTANCE);
+            compiled.speed = compileOperand(emitter, config::DOM_SPEED);
+            compiled.sizeStart = compileOperand(emitter, config::DOM_SIZE_START);
+            compiled.sizeEnd = compileOperand(emitter, config::DOM_SIZE_END);
+            compiled.rotation = compileOperand(emitter, config::DOM_ROTATION);
+            compiled.lifetime = compileOperand(emitter, config::DOM_LIFETIME);
+
+            auto convergePath = emitter;
+            convergePath.push_back(config::DOM_CONVERGE);
+            compiled.converge = Configuration::has(convergePath) && Configuration::get<bool>(convergePath);
+
+            program->push_back(compiled);
+        }
+
+        return program;
+    }
+} // namespace systems
@@ -0,0 +1,128 @@
+/*
+Copyright (c) 2021 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "misc/math.hpp"
+
+#include <SFML/Graphics/Texture.hpp>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace systems
+{
+    // --------------------------------------------------------------
+    //
+    // Runtime values an effect can scale its settings by, e.g., the number
+    // of particles in the virus death effect is scaled by how many
+    // bullets the virus had.
+    //
+    // --------------------------------------------------------------
+    enum class EffectParameter : std::uint8_t
+    {
+        None,
+        Bullets,
+        InnerRadius,
+        OuterRadius,
+        BulletSize,
+        Orientation,
+
+        Count // Not a parameter, it is the number of them
+    };
+
+    class EffectParameters
+    {
+      public:
+        EffectParameters(math::Point2f center) :
+            m_center(center)
+        {
+            m_values.fill(1.0f); // EffectParameter::None must evaluate to 1
+        }
+
+        auto getCenter() const { return m_center; }
+        float get(EffectParameter parameter) const { return m_values[static_cast<std::size_t>(parameter)]; }
+        void set(EffectParameter parameter, float value) { m_values[static_cast<std::size_t>(parameter)] = value; }
+
+      private:
+        math::Point2f m_center;
+        std::array<float, static_cast<std::size_t>(EffectParameter::Count)> m_values;
+    };
+
+    // --------------------------------------------------------------
+    //
+    // A single setting of an emitter: a value, optionally scaled by one
+    // of the runtime parameters, optionally normally distributed.
+    //
+    // --------------------------------------------------------------
+    struct EffectOperand
+    {
+        float value{ 0.0f };
+        EffectParameter scaleBy{ EffectParameter::None };
+        float stdev{ 0.0f };
+
+        float evaluate(const EffectParameters& parameters) const { return value * parameters.get(scaleBy); }
+
+        // The evaluated value is the mean when there is a standard deviation
+        template <typename Generator>
+        float sample(const EffectParameters& parameters, Generator& generator) const
+        {
+            auto mean = evaluate(parameters);
+            return (stdev > 0.0f) ? std::normal_distribution<float>(mean, stdev)(generator) : mean;
+        }
+    };
+
+    // --------------------------------------------------------------
+    //
+    // The compiled form of one emitter from the "effects" configuration.
+    // All strings have been resolved, the texture is already in hand
+    // and every setting is a number.
+    //
+    // --------------------------------------------------------------
+    struct EmitterProgram
+    {
+        enum class Pattern : std::uint8_t
+        {
+            Circle, // Evenly distributed around the center
+            Random  // Uniformly random angle around the center
+        };
+
+        std::shared_ptr<sf::Texture> texture;
+        Pattern pattern{ Pattern::Circle };
+        EffectOperand count;
+        EffectOperand distance;
+        EffectOperand speed;
+        EffectOperand sizeStart;
+        EffectOperand sizeEnd;
+        EffectOperand rotation;
+        EffectOperand lifetime; // Milliseconds
+        bool converge{ false }; // Speed is set so the particles reach the center at the end of their lifetime
+    };
+
+    using EffectProgram = std::vector<EmitterProgram>;
+
+    std::shared_ptr<EffectProgram> compileEffect(const std::string& name);
+} // namespace systems
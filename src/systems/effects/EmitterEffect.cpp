@@ -0,0 +1,124 @@
+/*
+Copyright (c) 2021 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "EmitterEffect.hpp"
+
+#include "systems/Particle.hpp"
+#include "systems/ParticleSystem.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+
+namespace systems
+{
+    EmitterEffect::EmitterEffect(std::shared_ptr<const EffectProgram> program, const EffectParameters& parameters) :
+        m_program(program),
+        m_parameters(parameters)
+    {
+    }
+
+    void EmitterEffect::update(const std::chrono::microseconds elapsedTime, ParticleSystem& ps)
+    {
+        ParticleEffect::update(elapsedTime, ps);
+
+        for (auto&& emitter : *m_program)
+        {
+            emit(emitter, ps);
+        }
+    }
+
+    // --------------------------------------------------------------
+    //
+    // Settings without a standard deviation are the same for all particles
+    // from the emitter and are computed once, the others are sampled per
+    // particle, along with the direction and position.
+    //
+    // --------------------------------------------------------------
+    void EmitterEffect::emit(const EmitterProgram& emitter, ParticleSystem& ps)
+    {
+        static std::random_device rd;
+        static std::mt19937 generator(rd());
+        static std::uniform_real_distribution<float> distCircle(0.0f, 2.0f * 3.14159f);
+
+        auto howMany = static_cast<std::uint16_t>(std::max(emitter.count.sample(m_parameters, generator), 0.0f) + 0.5f);
+        if (howMany == 0)
+        {
+            return;
+        }
+
+        auto center = m_parameters.getCenter();
+        Particle p;
+        p.texture = emitter.texture.get();
+        p.sizeStart = emitter.sizeStart.evaluate(m_parameters);
+        p.sizeEnd = emitter.sizeEnd.evaluate(m_parameters);
+        p.rotation = emitter.rotation.evaluate(m_parameters);
+        p.lifetime = std::chrono::microseconds(static_cast<std::int64_t>(emitter.lifetime.evaluate(m_parameters) * 1000));
+        p.speed = emitter.speed.evaluate(m_parameters);
+        auto distance = emitter.distance.evaluate(m_parameters);
+
+        float angleDiff = 2 * 3.14159f / howMany;
+        float angle = 0.0f;
+        for (decltype(howMany) i = 0; i < howMany; i++, angle += angleDiff)
+        {
+            auto particleAngle = (emitter.pattern == EmitterProgram::Pattern::Random) ? distCircle(generator) : angle;
+            auto particleDistance = (emitter.distance.stdev > 0.0f) ? emitter.distance.sample(m_parameters, generator) : distance;
+            if (emitter.sizeStart.stdev > 0.0f)
+            {
+                p.sizeStart = std::max(emitter.sizeStart.sample(m_parameters, generator), 0.0f);
+            }
+            if (emitter.sizeEnd.stdev > 0.0f)
+            {
+                p.sizeEnd = std::max(emitter.sizeEnd.sample(m_parameters, generator), 0.0f);
+            }
+            if (emitter.rotation.stdev > 0.0f)
+            {
+                p.rotation = emitter.rotation.sample(m_parameters, generator);
+            }
+            if (emitter.lifetime.stdev > 0.0f)
+            {
+                // A particle has to live for at least a moment
+                p.lifetime = std::max(std::chrono::microseconds(static_cast<std::int64_t>(emitter.lifetime.sample(m_parameters, generator) * 1000)), std::chrono::microseconds(1));
+            }
+            if (emitter.speed.stdev > 0.0f)
+            {
+                p.speed = emitter.speed.sample(m_parameters, generator);
+            }
+
+            p.direction.x = std::cos(particleAngle);
+            p.direction.y = std::sin(particleAngle);
+            // Adjust the center by the distance the particle should start from the effect center
+            p.center = { center.x + p.direction.x * particleDistance, center.y + p.direction.y * particleDistance };
+            if (emitter.converge)
+            {
+                // All particles finish at the same time on the center
+                p.speed = -(particleDistance / p.lifetime.count());
+            }
+
+            if (!ps.emit(p))
+            {
+                break; // Particle system is full, nothing more can be emitted
+            }
+        }
+    }
+} // namespace systems
@@ -22,33 +22,33 @@ THE SOFTWARE.
 
 #pragma once
 
+#include "EffectProgram.hpp"
 #include "ParticleEffect.hpp"
-#include "misc/math.hpp"
 
-#include <SFML/Graphics.hpp>
-#include <cstdint>
+#include <chrono>
 #include <memory>
-#include <random>
-#include <string>
 
 namespace systems
 {
-    class PlayerStartEffect : public ParticleEffect
+    // --------------------------------------------------------------
+    //
+    // The one effect that runs every compiled effect program.  The program
+    // says what to emit, the parameters provide the values only known
+    // at the time the effect is triggered, like where it is and how
+    // big the thing was that caused it.
+    //
+    // --------------------------------------------------------------
+    class EmitterEffect : public ParticleEffect
     {
       public:
-        PlayerStartEffect(math::Point2f center, std::uint16_t howMany, std::chrono::microseconds lifetime);
-        virtual void update(const std::chrono::microseconds elapsedTime, std::function<std::unique_ptr<Particle>()> getParticle, std::function<void(std::unique_ptr<Particle>)> addParticle);
+        EmitterEffect(std::shared_ptr<const EffectProgram> program, const EffectParameters& parameters);
+
+        virtual void update(const std::chrono::microseconds elapsedTime, ParticleSystem& ps) override;
 
       private:
-        math::Point2f m_center;
-        std::uint16_t m_howMany;
-        std::chrono::microseconds m_lifetime;
-        std::shared_ptr<sf::Texture> m_texture;
-
-        // Random number stuff
-        std::random_device m_rd;
-        std::mt19937 m_generator;
-        std::normal_distribution<float> m_distNormal;
-        std::uniform_real_distribution<float> m_distCircle;
+        std::shared_ptr<const EffectProgram> m_program;
+        EffectParameters m_parameters;
+
+        void emit(const EmitterProgram& emitter, ParticleSystem& ps);
     };
 } // namespace systems
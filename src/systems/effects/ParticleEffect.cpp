@@ -24,7 +24,7 @@ THE SOFTWARE.
 
 namespace systems
 {
-    void ParticleEffect::update(const std::chrono::microseconds elapsedTime, [[maybe_unused]] std::function<std::unique_ptr<Particle>()> getParticle, [[maybe_unused]] std::function<void(std::unique_ptr<Particle>)> addParticle)
+    void ParticleEffect::update(const std::chrono::microseconds elapsedTime, [[maybe_unused]] ParticleSystem& ps)
     {
         m_alive += elapsedTime;
     }
@@ -25,11 +25,12 @@ THE SOFTWARE.
 #include "systems/Particle.hpp"
 
 #include <chrono>
-#include <functional>
-#include <memory>
 
 namespace systems
 {
+    // Forward declaration, the particle system includes this header
+    class ParticleSystem;
+
     // --------------------------------------------------------------
     //
     // A particle effect is the thing that generates particles.  The particle
@@ -40,7 +41,9 @@ namespace systems
     class ParticleEffect
     {
       public:
-        virtual void update(const std::chrono::microseconds elapsedTime, std::function<std::unique_ptr<Particle>()> getParticle = nullptr, std::function<void(std::unique_ptr<Particle>)> addParticle = nullptr);
+        virtual ~ParticleEffect() {}
+
+        virtual void update(const std::chrono::microseconds elapsedTime, ParticleSystem& ps);
 
         auto getLifetime() { return m_lifetime; }
         auto getAlive() { return m_alive; }
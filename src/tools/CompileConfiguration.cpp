@@ -0,0 +1,91 @@
+/*
+Copyright (c) 2021 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "services/ConfigurationBlob.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <rapidjson/document.h>
+#include <sstream>
+#include <string>
+
+// --------------------------------------------------------------
+//
+// Build tool that compiles the game configuration into a blob and
+// writes it out as a byte array, to be included by Configuration.cpp.
+// The game opens the embedded blob without parsing any JSON.
+//
+// Usage: CompileConfiguration <json file> <output file>
+//
+// --------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    if (argc != 3)
+    {
+        std::cout << "usage: CompileConfiguration <json file> <output file>" << std::endl;
+        return 1;
+    }
+
+    std::ifstream in(argv[1]);
+    if (!in)
+    {
+        std::cout << "unable to open: " << argv[1] << std::endl;
+        return 1;
+    }
+    std::stringstream json;
+    json << in.rdbuf();
+    auto text = json.str();
+
+    rapidjson::Document dom;
+    dom.Parse(text.data(), text.size());
+    if (dom.HasParseError() || !dom.IsObject())
+    {
+        std::cout << "unable to parse: " << argv[1] << std::endl;
+        return 1;
+    }
+    auto blob = ConfigurationBlob::compile(dom);
+
+    std::ofstream out(argv[2], std::ios::trunc);
+    if (!out)
+    {
+        std::cout << "unable to create: " << argv[2] << std::endl;
+        return 1;
+    }
+    out << "// Generated by CompileConfiguration from " << std::filesystem::path(argv[1]).filename().string() << ", do not edit\n";
+    out << "alignas(8) static const std::uint8_t CONFIGURATION_GAME[] = {";
+    for (decltype(blob.size()) i = 0; i < blob.size(); i++)
+    {
+        out << ((i % 16 == 0) ? "\n    " : " ") << "0x" << std::hex << std::setw(2) << std::setfill('0') << static_cast<unsigned>(blob[i]) << ",";
+    }
+    out << "\n};\n";
+
+    if (!out)
+    {
+        std::cout << "error writing: " << argv[2] << std::endl;
+        return 1;
+    }
+    std::cout << "compiled " << argv[1] << " into " << blob.size() << " bytes" << std::endl;
+
+    return 0;
+}
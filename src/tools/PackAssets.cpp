@@ -0,0 +1,125 @@
+/*
+Copyright (c) 2021 James Dean Mathias
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "services/AssetArchive.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+// --------------------------------------------------------------
+//
+// Build tool that packs every file under the assets folder into a
+// single archive for AssetArchive to memory map at runtime.
+//
+// Usage: PackAssets <assets folder> <archive file>
+//
+// --------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    if (argc != 3)
+    {
+        std::cout << "usage: PackAssets <assets folder> <archive file>" << std::endl;
+        return 1;
+    }
+    std::filesystem::path root(argv[1]);
+    std::filesystem::path output(argv[2]);
+
+    //
+    // Gather the assets, sorted by name so the index can be binary searched
+    std::vector<std::filesystem::path> files;
+    for (auto& item : std::filesystem::recursive_directory_iterator(root))
+    {
+        if (item.is_regular_file())
+        {
+            files.push_back(item.path());
+        }
+    }
+    auto nameOf = [&root](const std::filesystem::path& file)
+    {
+        return std::filesystem::relative(file, root).generic_string();
+    };
+    std::sort(files.begin(), files.end(), [&nameOf](auto& a, auto& b) { return nameOf(a) < nameOf(b); });
+
+    auto align = [](std::uint64_t offset)
+    {
+        return (offset + AssetArchive::DATA_ALIGNMENT - 1) / AssetArchive::DATA_ALIGNMENT * AssetArchive::DATA_ALIGNMENT;
+    };
+
+    AssetArchive::Header header{};
+    std::memcpy(header.magic, AssetArchive::MAGIC, sizeof(header.magic));
+    header.version = AssetArchive::VERSION;
+    header.count = static_cast<std::uint32_t>(files.size());
+
+    std::vector<AssetArchive::Entry> entries(files.size());
+    std::uint64_t offset = align(sizeof(AssetArchive::Header) + entries.size() * sizeof(AssetArchive::Entry));
+    for (decltype(files.size()) i = 0; i < files.size(); i++)
+    {
+        auto name = nameOf(files[i]);
+        if (name.size() >= AssetArchive::NAME_LENGTH)
+        {
+            std::cout << "asset name too long for the archive: " << name << std::endl;
+            return 1;
+        }
+        std::memset(&entries[i], 0, sizeof(AssetArchive::Entry));
+        std::memcpy(entries[i].name, name.data(), name.size());
+        entries[i].offset = offset;
+        entries[i].size = std::filesystem::file_size(files[i]);
+        offset = align(offset + entries[i].size);
+    }
+
+    std::ofstream out(output, std::ios::binary | std::ios::trunc);
+    if (!out)
+    {
+        std::cout << "unable to create: " << output.string() << std::endl;
+        return 1;
+    }
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(AssetArchive::Entry));
+    for (decltype(files.size()) i = 0; i < files.size(); i++)
+    {
+        // Zero padding up to the aligned start of the asset
+        while (static_cast<std::uint64_t>(out.tellp()) < entries[i].offset)
+        {
+            out.put('\0');
+        }
+        if (entries[i].size > 0)
+        {
+            std::ifstream in(files[i], std::ios::binary);
+            out << in.rdbuf();
+        }
+    }
+
+    if (!out)
+    {
+        std::cout << "error writing: " << output.string() << std::endl;
+        return 1;
+    }
+    std::cout << "packed " << files.size() << " assets into " << output.string() << std::endl;
+
+    return 0;
+}
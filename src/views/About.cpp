@@ -76,23 +76,23 @@ namespace views
     ViewState About::update([[maybe_unused]] const std::chrono::microseconds elapsedTime, [[maybe_unused]] const std::chrono::system_clock::time_point now)
     {
         // Scroll the text up vertically over time
-        static const auto MOVE_RATE_US = Configuration::getGraphics().getViewCoordinates().height / 15000000;
+        auto moveRate = Configuration::getGraphics().getViewCoordinates().height / 15000000;
         for (auto&& item : m_items)
         {
-            item->setPosition({ item->getRegion().left, item->getRegion().top - MOVE_RATE_US * elapsedTime.count() });
+            item->setPosition({ item->getRegion().left, item->getRegion().top - moveRate * elapsedTime.count() });
         }
 
         return m_nextState;
     }
 
-    void About::render(sf::RenderTarget& renderTarget, const std::chrono::microseconds elapsedTime)
+    void About::render(renderers::RenderFrame& renderTarget, const std::chrono::microseconds elapsedTime)
     {
-        static const auto RENDER_TOP = -(0.35f * Configuration::getGraphics().getViewCoordinates().height);
+        auto renderTop = -(0.35f * Configuration::getGraphics().getViewCoordinates().height);
         MenuView::render(renderTarget, elapsedTime);
 
         for (auto&& item : m_items)
         {
-            if (item->getRegion().top > RENDER_TOP)
+            if (item->getRegion().top > renderTop)
             {
                 item->render(renderTarget);
             }
@@ -45,7 +45,7 @@ namespace views
         virtual void stop() override { KeyboardInput::instance().unregisterKeyReleasedHandler("escape"); }
 
         virtual ViewState update(const std::chrono::microseconds elapsedTime, const std::chrono::system_clock::time_point now) override;
-        virtual void render(sf::RenderTarget& renderTarget, const std::chrono::microseconds elapsedTime) override;
+        virtual void render(renderers::RenderFrame& renderTarget, const std::chrono::microseconds elapsedTime) override;
 
       private:
         ViewState m_nextState{ ViewState::About };
@@ -86,23 +86,23 @@ namespace views
     {
         //
         // Scroll the credits up vertically over time
-        static const auto MOVE_RATE_US = Configuration::getGraphics().getViewCoordinates().height / 8000000;
+        auto moveRate = Configuration::getGraphics().getViewCoordinates().height / 8000000;
         for (auto&& item : m_credits)
         {
-            item->setPosition({ item->getRegion().left, item->getRegion().top - MOVE_RATE_US * elapsedTime.count() });
+            item->setPosition({ item->getRegion().left, item->getRegion().top - moveRate * elapsedTime.count() });
         }
 
         return m_nextState;
     }
 
-    void Credits::render(sf::RenderTarget& renderTarget, [[maybe_unused]] const std::chrono::microseconds elapsedTime)
+    void Credits::render(renderers::RenderFrame& renderTarget, [[maybe_unused]] const std::chrono::microseconds elapsedTime)
     {
-        static const auto RENDER_TOP = -(0.35f * Configuration::getGraphics().getViewCoordinates().height);
+        auto renderTop = -(0.35f * Configuration::getGraphics().getViewCoordinates().height);
         MenuView::render(renderTarget, elapsedTime);
 
         for (auto&& item : m_credits)
         {
-            if (item->getRegion().top > RENDER_TOP)
+            if (item->getRegion().top > renderTop)
             {
                 item->render(renderTarget);
             }
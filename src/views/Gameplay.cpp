@@ -31,7 +31,7 @@ namespace views
     {
         //
         // Go ahead and tell the game model to load all common content
-        GameModel::loadContent();
+        GameModel::loadContent(m_content);
     }
 
     bool Gameplay::start()
@@ -39,10 +39,10 @@ namespace views
         m_nextState = ViewState::GamePlay;
 
         //
-        // Go ahead and get the game model created and initialize it so it can start
-        // loading content immediately.
+        // Go ahead and get the game model created so it can start loading content
+        // immediately.  It is initialized by update, once that content is ready.
         m_model = std::make_unique<GameModel>();
-        m_model->initialize();
+        m_initialized = false;
 
         KeyboardInput::instance().registerKeyReleasedHandler("escape", [this]()
                                                              { m_nextState = ViewState::LevelSelect; });
@@ -52,18 +52,41 @@ namespace views
 
     void Gameplay::stop()
     {
-        m_model->shutdown();
+        if (m_initialized)
+        {
+            m_model->shutdown();
+        }
         KeyboardInput::instance().unregisterKeyReleasedHandler("escape");
     }
 
     ViewState Gameplay::update(const std::chrono::microseconds elapsedTime, [[maybe_unused]] const std::chrono::system_clock::time_point now)
     {
+        if (!m_initialized)
+        {
+            //
+            // Don't hold up the game loop while the level content finishes loading
+            if (!m_model->contentReady())
+            {
+                return m_nextState;
+            }
+            if (!m_model->initialize())
+            {
+                return ViewState::LevelSelect;
+            }
+            m_initialized = true;
+        }
+
         m_model->update(elapsedTime);
         return m_nextState;
     }
 
-    void Gameplay::render(sf::RenderTarget& renderTarget, const std::chrono::microseconds elapsedTime)
+    void Gameplay::render(renderers::RenderFrame& renderTarget, const std::chrono::microseconds elapsedTime)
     {
+        if (!m_initialized)
+        {
+            renderTarget.clear(sf::Color::Black);
+            return;
+        }
         m_model->render(renderTarget, elapsedTime);
     }
 } // namespace views
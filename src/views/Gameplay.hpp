@@ -25,6 +25,7 @@ THE SOFTWARE.
 #include "GameModel.hpp"
 #include "View.hpp"
 #include "ViewState.hpp"
+#include "services/Content.hpp"
 
 #include <memory>
 
@@ -43,10 +44,12 @@ namespace views
         virtual void stop() override;
 
         virtual ViewState update(const std::chrono::microseconds elapsedTime, const std::chrono::system_clock::time_point now) override;
-        virtual void render(sf::RenderTarget& renderTarget, const std::chrono::microseconds elapsedTime) override;
+        virtual void render(renderers::RenderFrame& renderTarget, const std::chrono::microseconds elapsedTime) override;
 
       private:
         ViewState m_nextState{ ViewState::GamePlay };
+        Content::Group m_content; // The content common to every level
         std::unique_ptr<GameModel> m_model{ nullptr };
+        bool m_initialized{ false };
     };
 } // namespace views
@@ -66,6 +66,7 @@ namespace views
                     m_nextState = ViewState::GamePlay;
                 });
             m_menuItems.push_back(trainLevel1);
+            m_menuLevels.push_back(levels::LevelName::Training1);
             top += alphabetItem.getGlobalBounds().height * 1.5f;
 
             auto trainLevel2 = std::make_shared<ui::MenuItem>(
@@ -79,6 +80,7 @@ namespace views
                     m_nextState = ViewState::GamePlay;
                 });
             m_menuItems.push_back(trainLevel2);
+            m_menuLevels.push_back(levels::LevelName::Training2);
             top += alphabetItem.getGlobalBounds().height * 1.5f;
 
             auto trainLevel3 = std::make_shared<ui::MenuItem>(
@@ -92,6 +94,7 @@ namespace views
                     m_nextState = ViewState::GamePlay;
                 });
             m_menuItems.push_back(trainLevel3);
+            m_menuLevels.push_back(levels::LevelName::Training3);
             top += alphabetItem.getGlobalBounds().height * 1.5f;
 
             auto trainLevel4 = std::make_shared<ui::MenuItem>(
@@ -105,6 +108,7 @@ namespace views
                     m_nextState = ViewState::GamePlay;
                 });
             m_menuItems.push_back(trainLevel4);
+            m_menuLevels.push_back(levels::LevelName::Training4);
             top += alphabetItem.getGlobalBounds().height * 1.5f;
 
             auto trainLevel5 = std::make_shared<ui::MenuItem>(
@@ -118,6 +122,7 @@ namespace views
                     m_nextState = ViewState::GamePlay;
                 });
             m_menuItems.push_back(trainLevel5);
+            m_menuLevels.push_back(levels::LevelName::Training5);
             top += alphabetItem.getGlobalBounds().height * 2.0f;
 
             m_titlePatient.setPosition({ -(m_titlePatient.getRegion().width / 2.0f), top });
@@ -134,6 +139,7 @@ namespace views
                     m_nextState = ViewState::GamePlay;
                 });
             m_menuItems.push_back(patientLevel1);
+            m_menuLevels.push_back(levels::LevelName::Patient1);
             top += alphabetItem.getGlobalBounds().height * 1.5f;
 
             auto patientLevel2 = std::make_shared<ui::MenuItem>(
@@ -147,6 +153,7 @@ namespace views
                     m_nextState = ViewState::GamePlay;
                 });
             m_menuItems.push_back(patientLevel2);
+            m_menuLevels.push_back(levels::LevelName::Patient2);
             top += alphabetItem.getGlobalBounds().height * 1.5f;
 
             auto patientLevel3 = std::make_shared<ui::MenuItem>(
@@ -160,6 +167,7 @@ namespace views
                     m_nextState = ViewState::GamePlay;
                 });
             m_menuItems.push_back(patientLevel3);
+            m_menuLevels.push_back(levels::LevelName::Patient3);
 
             //
             // Go through the items and center everything horizontally
@@ -172,8 +180,7 @@ namespace views
             }
 
             //
-            // Select the first menu choice by default
-            m_activeMenuItem = 0;
+            // Select the first menu choice by default, or whichever was chosen before the layout was redone
             m_menuItems[m_activeMenuItem]->setActive();
 
             m_initialized = true;
@@ -233,22 +240,85 @@ namespace views
 
     ViewState LevelSelect::update([[maybe_unused]] const std::chrono::microseconds elapsedTime, [[maybe_unused]] const std::chrono::system_clock::time_point now)
     {
+        if (m_activeMenuItem != m_prefetchActiveMenuItem)
+        {
+            m_prefetchActiveMenuItem = m_activeMenuItem;
+            prefetch();
+        }
+
         return m_nextState;
     }
 
-    void LevelSelect::render(sf::RenderTarget& renderTarget, const std::chrono::microseconds elapsedTime)
+    // --------------------------------------------------------------
+    //
+    // Only the active menu item is drawn every frame, everything else is
+    // in the layer, which is redrawn when the active item changes.
+    //
+    // --------------------------------------------------------------
+    void LevelSelect::render(renderers::RenderFrame& renderTarget, const std::chrono::microseconds elapsedTime)
     {
+        if (m_activeMenuItem != m_layerActiveMenuItem)
+        {
+            m_layerActiveMenuItem = m_activeMenuItem;
+            invalidateLayer();
+        }
         MenuView::render(renderTarget, elapsedTime);
 
-        for (auto&& item : m_menuItems)
+        m_menuItems[m_activeMenuItem]->render(renderTarget);
+    }
+
+    void LevelSelect::renderLayer(renderers::RenderFrame& renderTarget)
+    {
+        MenuView::renderLayer(renderTarget);
+
+        for (decltype(m_menuItems.size()) item = 0; item < m_menuItems.size(); item++)
         {
-            item->render(renderTarget);
+            if (item != static_cast<decltype(item)>(m_activeMenuItem))
+            {
+                m_menuItems[item]->render(renderTarget);
+            }
         }
 
         m_titleTraining.render(renderTarget);
         m_titlePatient.render(renderTarget);
     }
 
+    // --------------------------------------------------------------
+    //
+    // The level the player is most likely to choose is the highlighted
+    // one, followed by its neighbors, so their content is prefetched in
+    // that order.  The default content budget leaves room for all three
+    // level backgrounds alongside the menu content, so moving the
+    // selection only evicts the levels furthest from it.  Anything already
+    // loaded, or already on its way, isn't loaded again.
+    //
+    // --------------------------------------------------------------
+    void LevelSelect::prefetch()
+    {
+        auto count = static_cast<int>(m_menuLevels.size());
+        GameModel::prefetchLevel(m_menuLevels[m_activeMenuItem]);
+        GameModel::prefetchLevel(m_menuLevels[(m_activeMenuItem + 1) % count]);
+        GameModel::prefetchLevel(m_menuLevels[(m_activeMenuItem + count - 1) % count]);
+    }
+
+    // --------------------------------------------------------------
+    //
+    // The titles and level items are positioned using the view coordinates
+    // and UI scale, so they are created again the next time the view starts.
+    //
+    // --------------------------------------------------------------
+    void LevelSelect::onGraphicsChanged()
+    {
+        MenuView::onGraphicsChanged();
+
+        m_titleTraining.updateScale();
+        m_titlePatient.updateScale();
+        m_menuItems.clear();
+        m_menuLevels.clear();
+        m_layerActiveMenuItem = -1;
+        m_initialized = false;
+    }
+
     void LevelSelect::onMouseMoved(math::Point2f point, [[maybe_unused]] std::chrono::microseconds elapsedTime)
     {
         for (decltype(m_menuItems.size()) item = 0; item < m_menuItems.size(); item++)
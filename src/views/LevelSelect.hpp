@@ -25,6 +25,7 @@ THE SOFTWARE.
 #include "MenuView.hpp"
 #include "UIFramework/MenuItem.hpp"
 #include "UIFramework/Text.hpp"
+#include "levels/LevelName.hpp"
 #include "services/Configuration.hpp"
 #include "services/Content.hpp"
 
@@ -46,7 +47,11 @@ namespace views
         virtual void stop() override;
 
         virtual ViewState update(const std::chrono::microseconds elapsedTime, const std::chrono::system_clock::time_point now) override;
-        virtual void render(sf::RenderTarget& renderTarget, const std::chrono::microseconds elapsedTime) override;
+        virtual void render(renderers::RenderFrame& renderTarget, const std::chrono::microseconds elapsedTime) override;
+
+      protected:
+        virtual void renderLayer(renderers::RenderFrame& renderTarget) override;
+        virtual void onGraphicsChanged() override;
 
       private:
         bool m_initialized{ false };
@@ -58,7 +63,12 @@ namespace views
         ui::Text m_titlePatient{ 0.0f, 0.0f, "Patient Simulations", Content::get<sf::Font>(content::KEY_FONT_LEVEL_SELECT), sf::Color(51, 102, 255), sf::Color::Black, Configuration::get<std::uint8_t>(config::FONT_LEVEL_SELECT_TITLE_SIZE) };
 
         std::vector<std::shared_ptr<ui::MenuItem>> m_menuItems;
+        std::vector<levels::LevelName> m_menuLevels; // The level chosen by each of the menu items
         std::int8_t m_activeMenuItem{ 0 };
+        std::int8_t m_layerActiveMenuItem{ -1 };    // Which item was active when the layer was last drawn
+        std::int8_t m_prefetchActiveMenuItem{ -1 }; // Which item was active when level content was last prefetched
+
+        void prefetch();
 
         void onMouseMoved(math::Point2f point, const std::chrono::microseconds elapsedTime);
         void onMouseReleased(sf::Mouse::Button button, math::Point2f point, const std::chrono::microseconds elapsedTime);
@@ -94,8 +94,7 @@ namespace views
             }
 
             //
-            // Select the first menu choice by default
-            m_activeMenuItem = 0;
+            // Select the first menu choice by default, or whichever was chosen before the layout was redone
             m_menuItems[m_activeMenuItem]->setActive();
 
             m_initialized = true;
@@ -155,16 +154,52 @@ namespace views
         return m_nextState;
     }
 
-    void MainMenu::render(sf::RenderTarget& renderTarget, const std::chrono::microseconds elapsedTime)
+    // --------------------------------------------------------------
+    //
+    // Only the active menu item is drawn every frame, everything else is
+    // in the layer, which is redrawn when the active item changes.
+    //
+    // --------------------------------------------------------------
+    void MainMenu::render(renderers::RenderFrame& renderTarget, const std::chrono::microseconds elapsedTime)
     {
+        if (m_activeMenuItem != m_layerActiveMenuItem)
+        {
+            m_layerActiveMenuItem = m_activeMenuItem;
+            invalidateLayer();
+        }
         MenuView::render(renderTarget, elapsedTime);
 
-        for (auto&& item : m_menuItems)
+        m_menuItems[m_activeMenuItem]->render(renderTarget);
+    }
+
+    void MainMenu::renderLayer(renderers::RenderFrame& renderTarget)
+    {
+        MenuView::renderLayer(renderTarget);
+
+        for (decltype(m_menuItems.size()) item = 0; item < m_menuItems.size(); item++)
         {
-            item->render(renderTarget);
+            if (item != static_cast<decltype(item)>(m_activeMenuItem))
+            {
+                m_menuItems[item]->render(renderTarget);
+            }
         }
     }
 
+    // --------------------------------------------------------------
+    //
+    // The menu items are sized using the UI scale, so they are created
+    // again the next time the view starts.
+    //
+    // --------------------------------------------------------------
+    void MainMenu::onGraphicsChanged()
+    {
+        MenuView::onGraphicsChanged();
+
+        m_menuItems.clear();
+        m_layerActiveMenuItem = -1;
+        m_initialized = false;
+    }
+
     void MainMenu::onMouseMoved(math::Point2f point, [[maybe_unused]] std::chrono::microseconds elapsedTime)
     {
         for (decltype(m_menuItems.size()) item = 0; item < m_menuItems.size(); item++)
@@ -46,7 +46,11 @@ namespace views
         virtual void stop() override;
 
         virtual ViewState update(const std::chrono::microseconds elapsedTime, const std::chrono::system_clock::time_point now) override;
-        virtual void render(sf::RenderTarget& renderTarget, const std::chrono::microseconds elapsedTime) override;
+        virtual void render(renderers::RenderFrame& renderTarget, const std::chrono::microseconds elapsedTime) override;
+
+      protected:
+        virtual void renderLayer(renderers::RenderFrame& renderTarget) override;
+        virtual void onGraphicsChanged() override;
 
       private:
         bool m_initialized{ false };
@@ -56,6 +60,7 @@ namespace views
 
         std::vector<std::shared_ptr<ui::MenuItem>> m_menuItems;
         std::int8_t m_activeMenuItem{ 0 };
+        std::int8_t m_layerActiveMenuItem{ -1 }; // Which item was active when the layer was last drawn
 
         void onMouseMoved(math::Point2f point, const std::chrono::microseconds elapsedTime);
         void onMouseReleased(sf::Mouse::Button button, math::Point2f point, const std::chrono::microseconds elapsedTime);
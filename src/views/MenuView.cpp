@@ -24,6 +24,17 @@ THE SOFTWARE.
 
 namespace views
 {
+    MenuView::MenuView()
+    {
+        m_graphicsHandlerId = Configuration::getGraphics().registerChangedHandler([this]()
+                                                                                  { onGraphicsChanged(); });
+    }
+
+    MenuView::~MenuView()
+    {
+        Configuration::getGraphics().unregisterChangedHandler(m_graphicsHandlerId);
+    }
+
     bool MenuView::start()
     {
         if (!m_initialized)
@@ -65,11 +76,30 @@ namespace views
         return true;
     }
 
-    void MenuView::render(sf::RenderTarget& renderTarget, [[maybe_unused]] const std::chrono::microseconds elapsedTime)
+    void MenuView::render(renderers::RenderFrame& renderTarget, [[maybe_unused]] const std::chrono::microseconds elapsedTime)
     {
         renderTarget.clear(sf::Color::Black);
         renderTarget.draw(m_background);
+        m_layer.render(renderTarget, [this](renderers::RenderFrame& layer)
+                       { renderLayer(layer); });
+    }
 
+    void MenuView::renderLayer(renderers::RenderFrame& renderTarget)
+    {
         m_title.render(renderTarget);
     }
+
+    // --------------------------------------------------------------
+    //
+    // The window has been recreated, the background and title are laid
+    // out again at the new view coordinates when the view next starts,
+    // and the layer is drawn again at the new resolution.
+    //
+    // --------------------------------------------------------------
+    void MenuView::onGraphicsChanged()
+    {
+        m_initialized = false;
+        m_title.updateScale();
+        m_layer.reset();
+    }
 } // namespace views
@@ -22,6 +22,7 @@ THE SOFTWARE.
 
 #pragma once
 
+#include "UIFramework/Layer.hpp"
 #include "UIFramework/Text.hpp"
 #include "View.hpp"
 #include "services/Configuration.hpp"
@@ -30,6 +31,7 @@ THE SOFTWARE.
 #include "services/ContentKey.hpp"
 
 #include <SFML/Graphics/Sprite.hpp>
+#include <cstdint>
 
 namespace views
 {
@@ -38,17 +40,36 @@ namespace views
     // Provides a class from which all other "menu" type views should inherit.
     // It provides the background and game title all those views share.
     //
+    // The title is kept in a retained layer, so it is only drawn once.
+    // Derived views can add their own unchanging elements to the layer by
+    // overriding renderLayer, and call invalidateLayer whenever any of them
+    // change.  The background covers the whole window and is already a
+    // single sprite, so it is drawn directly, keeping the layer only as
+    // large as the elements in it.
+    //
+    // When the graphics options change, onGraphicsChanged is called so
+    // the layout can be done again, the next time the view is started.
+    // Derived views that lay out their own elements override it too.
+    //
     // --------------------------------------------------------------
     class MenuView : public View
     {
       public:
-        using View::View;
+        MenuView();
+        virtual ~MenuView();
         virtual bool start() override;
 
-        virtual void render(sf::RenderTarget& renderTarget, const std::chrono::microseconds elapsedTime) override;
+        virtual void render(renderers::RenderFrame& renderTarget, const std::chrono::microseconds elapsedTime) override;
+
+      protected:
+        virtual void renderLayer(renderers::RenderFrame& renderTarget);
+        virtual void onGraphicsChanged();
+        void invalidateLayer() { m_layer.invalidate(); }
 
       private:
         bool m_initialized{ false };
+        std::uint32_t m_graphicsHandlerId{ 0 };
+        ui::Layer m_layer;
         sf::Sprite m_background;
         ui::Text m_title{ 0.0f, 0.0f, "Coronavirus - Nano Force", Content::get<sf::Font>(content::KEY_FONT_TITLE), sf::Color::Red, sf::Color::Black, Configuration::get<std::uint8_t>(config::FONT_TITLE_SIZE) };
     };
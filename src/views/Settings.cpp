@@ -47,7 +47,8 @@ namespace views
             addMusicOption();
             addKeyboardOptions();
 
-            m_activeOption = 0;
+            //
+            // The first option is active by default, or whichever was active before the layout was redone
             m_options[m_activeOption]->setActive();
 
             m_initialized = true;
@@ -80,7 +81,7 @@ namespace views
         return m_nextState;
     }
 
-    void Settings::render(sf::RenderTarget& renderTarget, const std::chrono::microseconds elapsedTime)
+    void Settings::render(renderers::RenderFrame& renderTarget, const std::chrono::microseconds elapsedTime)
     {
         MenuView::render(renderTarget, elapsedTime);
 
@@ -383,6 +384,21 @@ namespace views
         m_options.push_back(fireSecondary);
     }
 
+    // --------------------------------------------------------------
+    //
+    // The options are positioned using the view coordinates, so they are
+    // created again, from the current settings, the next time the view starts.
+    //
+    // --------------------------------------------------------------
+    void Settings::onGraphicsChanged()
+    {
+        MenuView::onGraphicsChanged();
+
+        m_selectKey.updateScale();
+        m_options.clear();
+        m_initialized = false;
+    }
+
     void Settings::onMouseMoved(math::Point2f point, [[maybe_unused]] std::chrono::microseconds elapsedTime)
     {
         for (decltype(m_options.size()) item = 0; item < m_options.size(); item++)
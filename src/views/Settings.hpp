@@ -48,7 +48,10 @@ namespace views
         virtual void stop() override;
 
         virtual ViewState update(const std::chrono::microseconds elapsedTime, const std::chrono::system_clock::time_point now) override;
-        virtual void render(sf::RenderTarget& renderTarget, const std::chrono::microseconds elapsedTime) override;
+        virtual void render(renderers::RenderFrame& renderTarget, const std::chrono::microseconds elapsedTime) override;
+
+      protected:
+        virtual void onGraphicsChanged() override;
 
       private:
         bool m_initialized{ false };
@@ -24,6 +24,7 @@ THE SOFTWARE.
 
 #include "ViewState.hpp"
 #include "misc/math.hpp"
+#include "renderers/RenderFrame.hpp"
 
 #include <SFML/Graphics.hpp>
 #include <SFML/Window/Event.hpp>
@@ -46,6 +47,6 @@ namespace views
         virtual void stop() {}
 
         virtual ViewState update(const std::chrono::microseconds elapsedTime, const std::chrono::system_clock::time_point now) = 0;
-        virtual void render(sf::RenderTarget& renderTarget, const std::chrono::microseconds elapsedTime) = 0;
+        virtual void render(renderers::RenderFrame& renderTarget, const std::chrono::microseconds elapsedTime) = 0;
     };
 } // namespace views